@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+/// Generate a reproducible pseudo-random test signal in the range
+/// [-amplitude, amplitude].
+template <class T>
+std::vector<T> bench_signal(size_t length, double amplitude = 1000) {
+    std::vector<T> signal(length);
+    uint32_t seed = 0x12345678;
+    for (T &s : signal) {
+        seed = seed * 1664525u + 1013904223u;
+        s = T(amplitude * (double(seed >> 8) / double(1u << 23) - 1));
+    }
+    return signal;
+}
+
+/// Written to by @ref bench_sink.
+static volatile double bench_sink_value;
+
+/// Prevent the compiler from optimizing away the results of a benchmark.
+template <class T>
+void bench_sink(const std::vector<T> &output) {
+    double sum = 0;
+    for (const T &y : output)
+        sum += double(y);
+    bench_sink_value = sum;
+}
+
+/**
+ * @brief   Measure the throughput of a block operation.
+ *
+ * @param   run
+ *          Function that processes @p samples samples each time it is called.
+ * @param   samples
+ *          The number of samples processed per call.
+ * @param   repetitions
+ *          The number of measurements, the fastest one is returned.
+ * @return  The number of samples processed per second.
+ */
+template <class F>
+double bench_throughput(F &&run, size_t samples, unsigned repetitions = 7) {
+    using clock = std::chrono::steady_clock;
+    double best = 0;
+    run(); // warm-up
+    for (unsigned r = 0; r < repetitions; ++r) {
+        auto start = clock::now();
+        run();
+        auto stop = clock::now();
+        double seconds = std::chrono::duration<double>(stop - start).count();
+        best = std::max(best, double(samples) / seconds);
+    }
+    return best;
+}
+
+/// Measure the throughput of a filter that is called sample by sample.
+template <class Filter, class T>
+double bench_filter(Filter filter, const std::vector<T> &input,
+                    unsigned repetitions = 7) {
+    std::vector<T> output(input.size());
+    double result = bench_throughput(
+        [&] {
+            for (size_t i = 0; i < input.size(); ++i)
+                output[i] = filter(input[i]);
+        },
+        input.size(), repetitions);
+    bench_sink(output);
+    return result;
+}
+
+/// Print a single benchmark result.
+inline void bench_print(const char *name, double samples_per_second,
+                        size_t bytes = 0) {
+    if (bytes)
+        std::printf("%-44s %14.0f samples/s %8zu bytes\n", name,
+                    samples_per_second, bytes);
+    else
+        std::printf("%-44s %14.0f samples/s\n", name, samples_per_second);
+}
@@ -0,0 +1,59 @@
+/**
+ * Compare the throughput of the Direct Form 1, Direct Form 2 and Transposed
+ * Direct Form 2 BiQuad implementations, on their own and in a cascade.
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/Butterworth.hpp>
+
+template <template <class> class BiQuad, class T>
+void bench_biquad(const char *name, const std::vector<T> &input) {
+    auto coeff = butter_coeff<2, T>(0.1)[0];
+    bench_print(name, bench_filter(BiQuad<T>{coeff}, input));
+}
+
+template <template <class> class BiQuad, class T>
+void bench_sos(const char *name, const std::vector<T> &input) {
+    constexpr uint8_t Order = 8;
+    auto filter = butter<Order, T, BiQuad<T>>(0.1);
+    bench_print(name, bench_filter(filter, input), sizeof(filter));
+}
+
+template <class T>
+void bench_process(const char *name, const std::vector<T> &input) {
+    BiQuadFilterDF2T<T> biquad = butter_coeff<2, T>(0.1)[0];
+    std::vector<T> output(input.size());
+    bench_print(name, bench_throughput(
+                          [&] {
+                              biquad.process(input.data(), output.data(),
+                                             input.size());
+                          },
+                          input.size()));
+    bench_sink(output);
+}
+
+template <class T>
+void bench_all(const char *type) {
+    auto input = bench_signal<T>(1 << 16);
+    char name[64];
+    std::snprintf(name, sizeof(name), "BiQuadFilterDF1<%s>", type);
+    bench_biquad<BiQuadFilterDF1>(name, input);
+    std::snprintf(name, sizeof(name), "BiQuadFilterDF2<%s>", type);
+    bench_biquad<BiQuadFilterDF2>(name, input);
+    std::snprintf(name, sizeof(name), "BiQuadFilterDF2T<%s>", type);
+    bench_biquad<BiQuadFilterDF2T>(name, input);
+    std::snprintf(name, sizeof(name), "BiQuadFilterDF2T<%s>::process", type);
+    bench_process(name, input);
+    std::snprintf(name, sizeof(name), "butter<8, %s, DF1>", type);
+    bench_sos<BiQuadFilterDF1>(name, input);
+    std::snprintf(name, sizeof(name), "butter<8, %s, DF2>", type);
+    bench_sos<BiQuadFilterDF2>(name, input);
+    std::snprintf(name, sizeof(name), "butter<8, %s, DF2T>", type);
+    bench_sos<BiQuadFilterDF2T>(name, input);
+}
+
+int main() {
+    bench_all<float>("float");
+    bench_all<double>("double");
+}
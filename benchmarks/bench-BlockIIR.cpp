@@ -0,0 +1,61 @@
+/**
+ * Compare the throughput of the sample-by-sample IIR recursion and the 
+ * state-space block recursion of BlockIIRFilter, for a single stream.
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/BlockIIRFilter.hpp>
+#include <Filters/Butterworth.hpp>
+#include <Filters/IIRFilter.hpp>
+
+template <class Filter, class T>
+double bench_process(Filter filter, const std::vector<T> &input) {
+    std::vector<T> output(input.size());
+    double result = bench_throughput(
+        [&] { filter.process(input.data(), output.data(), input.size()); },
+        input.size());
+    bench_sink(output);
+    return result;
+}
+
+template <uint8_t Order, size_t K, class T>
+void bench_block(const char *type) {
+    auto input = bench_signal<T>(1 << 16, 1);
+    auto tf = sos2tf(butter_coeff<Order, T>(0.2));
+    constexpr size_t P = Order;
+    char name[64];
+    std::snprintf(name, sizeof(name), "IIRFilter<%zu, %zu, %s>", P + 1, P + 1,
+                  type);
+    bench_print(name, bench_filter(IIRFilter<P + 1, P + 1, T>{tf}, input));
+    std::snprintf(name, sizeof(name), "BlockIIRFilter<%zu, %zu, %s>()", P, K,
+                  type);
+    bench_print(name, bench_filter(BlockIIRFilter<P, K, T>{tf}, input));
+    std::snprintf(name, sizeof(name), "BlockIIRFilter<%zu, %zu, %s>::process",
+                  P, K, type);
+    bench_print(name, bench_process(BlockIIRFilter<P, K, T>{tf}, input));
+}
+
+template <size_t K, class T>
+void bench_biquad(const char *type) {
+    auto input = bench_signal<T>(1 << 16, 1);
+    auto tf = butter_coeff<2, T>(0.2)[0];
+    char name[64];
+    std::snprintf(name, sizeof(name), "BiQuadFilterDF2T<%s>::process", type);
+    bench_print(name, bench_process(BiQuadFilterDF2T<T>{tf}, input));
+    std::snprintf(name, sizeof(name), "BlockIIRFilter<2, %zu, %s>::process",
+                  K, type);
+    bench_print(name, bench_process(BlockIIRFilter<2, K, T>{tf}, input));
+}
+
+int main() {
+    bench_biquad<8, float>("float");
+    bench_biquad<16, float>("float");
+    bench_biquad<32, float>("float");
+    bench_biquad<8, double>("double");
+    bench_biquad<16, double>("double");
+    bench_block<4, 8, float>("float");
+    bench_block<4, 16, float>("float");
+    bench_block<6, 8, double>("double");
+    bench_block<6, 16, double>("double");
+}
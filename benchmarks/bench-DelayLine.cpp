@@ -0,0 +1,61 @@
+/**
+ * Compare the memory usage and throughput of the rotated-coefficient ring
+ * buffer layout of FIRFilter and IIRFilter (2N - 1 coefficients) to the
+ * DelayLine layout of CompactFIRFilter and CompactIIRFilter (N coefficients).
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/FIRFilter.hpp>
+#include <Filters/IIRFilter.hpp>
+
+template <uint8_t N, class T>
+AH::Array<T, N> bench_coefficients() {
+    AH::Array<T, N> b;
+    for (uint8_t i = 0; i < N; ++i)
+        b[i] = T((i % 5) + 1) / T(N);
+    return b;
+}
+
+template <uint8_t N, class T>
+void bench_fir(const char *type) {
+    auto input = bench_signal<T>(1 << 16);
+    auto b = bench_coefficients<N, T>();
+    char name[64];
+    std::snprintf(name, sizeof(name), "FIRFilter<%d, %s>", N, type);
+    bench_print(name, bench_filter(FIRFilter<N, T>{b}, input),
+                sizeof(FIRFilter<N, T>));
+    std::snprintf(name, sizeof(name), "CompactFIRFilter<%d, %s>", N, type);
+    bench_print(name, bench_filter(CompactFIRFilter<N, T>{b}, input),
+                sizeof(CompactFIRFilter<N, T>));
+}
+
+template <uint8_t N, class T>
+void bench_iir(const char *type) {
+    auto input = bench_signal<T>(1 << 16);
+    auto b = bench_coefficients<N, T>();
+    auto a = bench_coefficients<N, T>();
+    a[0] = T(1);
+    for (uint8_t i = 1; i < N; ++i)
+        a[i] = a[i] / T(64); // keep the filter stable
+    char name[64];
+    std::snprintf(name, sizeof(name), "IIRFilter<%d, %d, %s>", N, N, type);
+    bench_print(name, bench_filter(IIRFilter<N, N, T>{b, a}, input),
+                sizeof(IIRFilter<N, N, T>));
+    std::snprintf(name, sizeof(name), "CompactIIRFilter<%d, %d, %s>", N, N,
+                  type);
+    bench_print(name, bench_filter(CompactIIRFilter<N, N, T>{b, a}, input),
+                sizeof(CompactIIRFilter<N, N, T>));
+}
+
+int main() {
+    bench_fir<4, float>("float");
+    bench_fir<16, float>("float");
+    bench_fir<64, float>("float");
+    bench_fir<128, float>("float");
+    bench_fir<16, int32_t>("int32_t");
+    bench_fir<64, int32_t>("int32_t");
+    bench_iir<3, float>("float");
+    bench_iir<7, float>("float");
+    bench_iir<7, double>("double");
+}
@@ -0,0 +1,48 @@
+/**
+ * Compare the throughput of C separate EMA instances and a single EMABank for
+ * different numbers of channels.
+ */
+
+#include "Benchmark.hpp"
+
+#include <AH/Filters/EMA.hpp>
+
+template <uint8_t K, uint16_t C, class input_t, class state_t>
+void bench_bank(const char *type) {
+    const size_t frames = 1 << 12;
+    auto input = bench_signal<input_t>(frames * C, 1000);
+    std::vector<input_t> output(input.size());
+
+    std::vector<EMA<K, input_t, state_t>> filters(C);
+    double separate = bench_throughput(
+        [&] {
+            for (size_t f = 0; f < frames; ++f)
+                for (uint16_t c = 0; c < C; ++c)
+                    output[f * C + c] = filters[c](input[f * C + c]);
+        },
+        input.size());
+    bench_sink(output);
+
+    EMABank<K, C, input_t, state_t> bank;
+    double banked = bench_throughput(
+        [&] {
+            for (size_t f = 0; f < frames; ++f)
+                bank(&input[f * C], &output[f * C]);
+        },
+        input.size());
+    bench_sink(output);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%d x EMA<%d, %s>", C, K, type);
+    bench_print(name, separate, C * sizeof(EMA<K, input_t, state_t>));
+    std::snprintf(name, sizeof(name), "EMABank<%d, %d, %s>", K, C, type);
+    bench_print(name, banked, sizeof(EMABank<K, C, input_t, state_t>));
+}
+
+int main() {
+    bench_bank<6, 64, int16_t, uint32_t>("int16_t, uint32_t");
+    bench_bank<6, 256, int16_t, uint32_t>("int16_t, uint32_t");
+    bench_bank<5, 64, uint16_t, uint16_t>("uint16_t, uint16_t");
+    bench_bank<5, 256, uint16_t, uint16_t>("uint16_t, uint16_t");
+    bench_bank<6, 100, int16_t, uint32_t>("int16_t, uint32_t");
+}
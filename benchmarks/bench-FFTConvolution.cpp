@@ -0,0 +1,54 @@
+/**
+ * Measure the crossover point between direct form and FFT convolution in
+ * FFTConvolutionFIR, for the default block size. The result is used as the
+ * default value of FFT_CONVOLUTION_CROSSOVER.
+ */
+
+#include "Benchmark.hpp"
+
+#include <AH/STL/climits>
+#include <Filters/FFTConvolutionFIR.hpp>
+
+#include <memory>
+
+constexpr size_t block_size = 64;
+
+template <size_t N, size_t Crossover>
+double bench_fft_convolution(const std::vector<float> &input) {
+    std::unique_ptr<AH::Array<float, N>> b{new AH::Array<float, N>};
+    for (size_t i = 0; i < N; ++i)
+        (*b)[i] = float((i % 7) + 1) / float(N);
+    using Filter = FFTConvolutionFIR<N, float, block_size, Crossover>;
+    std::unique_ptr<Filter> filter{new Filter{*b}};
+    std::vector<float> output(input.size());
+    double result = bench_throughput(
+        [&] { filter->process(input.data(), output.data(), input.size()); },
+        input.size(), 5);
+    bench_sink(output);
+    return result;
+}
+
+template <size_t N>
+void bench_crossover(const std::vector<float> &input) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "direct form (N = %zu)", N);
+    bench_print(name, bench_fft_convolution<N, SIZE_MAX>(input));
+    std::snprintf(name, sizeof(name), "FFT convolution (N = %zu, B = %zu)", N,
+                  block_size);
+    bench_print(name, bench_fft_convolution<N, 0>(input));
+}
+
+int main() {
+    auto input = bench_signal<float>(1 << 16, 1);
+    bench_crossover<65>(input);
+    bench_crossover<96>(input);
+    bench_crossover<128>(input);
+    bench_crossover<160>(input);
+    bench_crossover<192>(input);
+    bench_crossover<256>(input);
+    bench_crossover<384>(input);
+    bench_crossover<512>(input);
+    bench_crossover<1024>(input);
+    bench_crossover<4096>(input);
+    bench_crossover<16384>(input);
+}
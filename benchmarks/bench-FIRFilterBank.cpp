@@ -0,0 +1,55 @@
+/**
+ * Compare the throughput of C separate FIRFilter instances and a single
+ * FIRFilterBank for different numbers of channels.
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/FIRFilter.hpp>
+#include <Filters/FIRFilterBank.hpp>
+
+template <uint8_t N, uint8_t C, class T>
+void bench_bank(const char *type) {
+    AH::Array<T, N> b;
+    for (uint8_t i = 0; i < N; ++i)
+        b[i] = T(i % 5 + 1) / T(N);
+
+    const size_t frames = 1 << 13;
+    auto input = bench_signal<T>(frames * C);
+    std::vector<T> output(input.size());
+
+    std::vector<FIRFilter<N, T>> filters(C, b);
+    double separate = bench_throughput(
+        [&] {
+            for (size_t f = 0; f < frames; ++f)
+                for (uint8_t c = 0; c < C; ++c)
+                    output[f * C + c] = filters[c](input[f * C + c]);
+        },
+        input.size());
+    bench_sink(output);
+
+    FIRFilterBank<N, C, T> bank = b;
+    double banked = bench_throughput(
+        [&] {
+            for (size_t f = 0; f < frames; ++f)
+                bank(&input[f * C], &output[f * C]);
+        },
+        input.size());
+    bench_sink(output);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%d x FIRFilter<%d, %s>", C, N, type);
+    bench_print(name, separate, C * sizeof(FIRFilter<N, T>));
+    std::snprintf(name, sizeof(name), "FIRFilterBank<%d, %d, %s>", N, C, type);
+    bench_print(name, banked, sizeof(FIRFilterBank<N, C, T>));
+}
+
+int main() {
+    bench_bank<16, 4, float>("float");
+    bench_bank<16, 16, float>("float");
+    bench_bank<16, 64, float>("float");
+    bench_bank<64, 16, float>("float");
+    bench_bank<64, 64, float>("float");
+    bench_bank<31, 16, int32_t>("int32_t");
+    bench_bank<31, 64, int32_t>("int32_t");
+}
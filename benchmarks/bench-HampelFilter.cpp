@@ -0,0 +1,67 @@
+/**
+ * Compare the throughput of HampelFilter (sorted window, O(log N) median
+ * absolute deviation) to a naive Hampel filter that computes the median and
+ * the median absolute deviation from scratch for every sample, with two
+ * MedianFilter-style copy + nth_element passes.
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/HampelFilter.hpp>
+
+#include <array>
+
+template <uint8_t N, class T>
+class NaiveHampelFilter {
+  public:
+    NaiveHampelFilter(float k = 3) : threshold(k * 1.4826f) {}
+
+    T operator()(T x) {
+        previousInputs[index] = x;
+        if (++index == N)
+            index = 0;
+        constexpr uint8_t h = (N - 1) / 2;
+        std::array<T, N> scratch = previousInputs;
+        std::nth_element(scratch.begin(), scratch.begin() + h, scratch.end());
+        const T median = scratch[h];
+        for (T &s : scratch)
+            s = s < median ? median - s : s - median;
+        std::nth_element(scratch.begin(), scratch.begin() + h, scratch.end());
+        const T center = previousInputs[(index + h) % N];
+        const T deviation = center < median ? median - center : center - median;
+        return float(deviation) > threshold * float(scratch[h]) ? median
+                                                                : center;
+    }
+
+  private:
+    float threshold;
+    uint8_t index = 0;
+    std::array<T, N> previousInputs = {{}};
+};
+
+template <uint8_t N, class T>
+void bench_hampel(const char *type) {
+    auto input = bench_signal<T>(1 << 15);
+    // Add some spikes.
+    for (size_t i = 0; i < input.size(); i += 97)
+        input[i] *= 10;
+    char name[64];
+    std::snprintf(name, sizeof(name), "NaiveHampelFilter<%d, %s>", N, type);
+    double naive = bench_filter(NaiveHampelFilter<N, T>{}, input, 5);
+    bench_print(name, naive, sizeof(NaiveHampelFilter<N, T>));
+    std::snprintf(name, sizeof(name), "HampelFilter<%d, %s>", N, type);
+    double sorted = bench_filter(HampelFilter<N, T>{}, input, 5);
+    bench_print(name, sorted, sizeof(HampelFilter<N, T>));
+    std::printf("%-44s %14.2fx\n", "  speedup", sorted / naive);
+}
+
+int main() {
+    bench_hampel<5, float>("float");
+    bench_hampel<9, float>("float");
+    bench_hampel<25, float>("float");
+    bench_hampel<51, float>("float");
+    bench_hampel<101, float>("float");
+    bench_hampel<201, float>("float");
+    bench_hampel<9, int16_t>("int16_t");
+    bench_hampel<101, int16_t>("int16_t");
+}
@@ -0,0 +1,62 @@
+/**
+ * Compare the throughput of MedianFilter (copy + nth_element) and
+ * SlidingMedianFilter (two heaps) for different window lengths, to find the
+ * length at which SlidingMedianFilter becomes faster, and of
+ * CountingMedianFilter (histogram) for 10-bit ADC readings.
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/CountingMedianFilter.hpp>
+#include <Filters/MedianFilter.hpp>
+#include <Filters/SlidingMedianFilter.hpp>
+
+template <uint8_t N, class T>
+void bench_median(const char *type) {
+    auto input = bench_signal<T>(1 << 15);
+    double nth = bench_filter(MedianFilter<N, T>{}, input, 5);
+    double sliding = bench_filter(SlidingMedianFilter<N, T>{}, input, 5);
+    char name[64];
+    std::snprintf(name, sizeof(name), "MedianFilter<%d, %s>", N, type);
+    bench_print(name, nth, sizeof(MedianFilter<N, T>));
+    std::snprintf(name, sizeof(name), "SlidingMedianFilter<%d, %s>", N, type);
+    bench_print(name, sliding, sizeof(SlidingMedianFilter<N, T>));
+    std::printf("%-44s %14.2fx\n", "  speedup", sliding / nth);
+}
+
+template <uint8_t N>
+void bench_counting() {
+    auto input = bench_signal<uint16_t>(1 << 15, 511);
+    for (auto &x : input)
+        x = (x + 512) & 0x3FF;
+    char name[64];
+    std::snprintf(name, sizeof(name), "MedianFilter<%d, uint16_t>", N);
+    bench_print(name, bench_filter(MedianFilter<N, uint16_t>{}, input, 5),
+                sizeof(MedianFilter<N, uint16_t>));
+    std::snprintf(name, sizeof(name), "SlidingMedianFilter<%d, uint16_t>", N);
+    bench_print(name,
+                bench_filter(SlidingMedianFilter<N, uint16_t>{}, input, 5),
+                sizeof(SlidingMedianFilter<N, uint16_t>));
+    std::snprintf(name, sizeof(name), "CountingMedianFilter<%d, 10>", N);
+    bench_print(name, bench_filter(CountingMedianFilter<N, 10>{}, input, 5),
+                sizeof(CountingMedianFilter<N, 10>));
+}
+
+int main() {
+    bench_median<3, float>("float");
+    bench_median<5, float>("float");
+    bench_median<7, float>("float");
+    bench_median<9, float>("float");
+    bench_median<15, float>("float");
+    bench_median<25, float>("float");
+    bench_median<51, float>("float");
+    bench_median<101, float>("float");
+    bench_median<201, float>("float");
+    bench_median<5, int16_t>("int16_t");
+    bench_median<9, int16_t>("int16_t");
+    bench_median<25, int16_t>("int16_t");
+    bench_median<101, int16_t>("int16_t");
+    bench_counting<9>();
+    bench_counting<101>();
+    bench_counting<255>();
+}
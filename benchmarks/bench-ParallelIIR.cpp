@@ -0,0 +1,40 @@
+/**
+ * Compare the throughput of Butterworth filters in cascade form (SOSFilter),
+ * direct form (IIRFilter) and parallel form (ParallelIIRFilter).
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/Butterworth.hpp>
+#include <Filters/IIRFilter.hpp>
+#include <Filters/ParallelIIRFilter.hpp>
+
+template <uint8_t Order>
+void bench_forms() {
+    constexpr size_t S = (Order + 1) / 2;
+    auto input = bench_signal<double>(1 << 16, 1);
+    auto sos = butter_coeff<Order, double>(0.2);
+    auto tf = sos2tf(sos);
+    char name[64];
+
+    std::snprintf(name, sizeof(name), "SOSFilter<double, %zu>", S);
+    bench_print(name, bench_filter(SOSFilter<double, S>{sos}, input));
+    std::snprintf(name, sizeof(name), "SOSFilter<double, %zu, DF2T>", S);
+    bench_print(name, bench_filter(
+                          SOSFilter<double, S, BiQuadFilterDF2T<double>>{sos},
+                          input));
+    std::snprintf(name, sizeof(name), "IIRFilter<%zu, %zu, double>", 2 * S + 1,
+                  2 * S + 1);
+    bench_print(name, bench_filter(IIRFilter<2 * S + 1, 2 * S + 1, double>{tf},
+                                   input));
+    std::snprintf(name, sizeof(name), "ParallelIIRFilter<double, %zu>", S);
+    bench_print(name, bench_filter(ParallelIIRFilter<double, S>{tf2parallel(tf)},
+                                   input));
+}
+
+int main() {
+    bench_forms<4>();
+    bench_forms<8>();
+    bench_forms<12>();
+    bench_forms<16>();
+}
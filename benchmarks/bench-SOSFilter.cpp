@@ -0,0 +1,85 @@
+/**
+ * Compare the throughput of sample-by-sample and block processing of long
+ * Butterworth cascades, using the DF1 and DF2T BiQuad implementations.
+ * SOSFilter::process is sample-major: every sample goes through all sections
+ * before the next one. It is compared to a section-major variant, which runs
+ * the entire block through one section before moving on to the next.
+ *
+ * The BiQuad implementations use std::fma, so build with hardware FMA enabled
+ * (e.g. -march=native), otherwise the software fallback of std::fma dominates
+ * and all variants run at the same, much lower speed.
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/Butterworth.hpp>
+
+#include <utility>
+
+/// Filter a block in place with a single section, using its block processing
+/// function if it has one (DF2T)...
+template <class Section, class T>
+auto section_block(Section &section, T *data, size_t n, int)
+    -> decltype(section.process(data, data, n)) {
+    section.process(data, data, n);
+}
+
+/// ... or sample by sample otherwise (DF1).
+template <class Section, class T>
+void section_block(Section &section, T *data, size_t n, long) {
+    for (size_t i = 0; i < n; ++i)
+        data[i] = section(data[i]);
+}
+
+template <uint8_t Order, template <class> class BiQuad, class T>
+void bench_cascade(const char *form, const char *type) {
+    auto input = bench_signal<T>(1 << 16);
+    std::vector<T> output(input.size());
+    char name[64];
+
+    auto filter = butter<Order, T, BiQuad<T>>(0.1);
+    std::snprintf(name, sizeof(name), "butter<%d, %s, %s>", Order, type, form);
+    bench_print(name, bench_filter(filter, input));
+
+    const size_t block_size = 256;
+    std::snprintf(name, sizeof(name), "butter<%d, %s, %s>::process(%zu)",
+                  Order, type, form, block_size);
+    bench_print(name, bench_throughput(
+                          [&] {
+                              for (size_t i = 0; i < input.size();
+                                   i += block_size)
+                                  filter.process(&input[i], &output[i],
+                                                 block_size);
+                          },
+                          input.size()));
+
+    // Section-major: the same sections, but one section at a time.
+    const auto coefficients = butter_coeff<Order, T>(0.1);
+    std::vector<BiQuad<T>> sections(coefficients.begin(), coefficients.end());
+    std::snprintf(name, sizeof(name), "butter<%d, %s, %s> section-major(%zu)",
+                  Order, type, form, block_size);
+    bench_print(name, bench_throughput(
+                          [&] {
+                              for (size_t i = 0; i < input.size();
+                                   i += block_size) {
+                                  std::copy_n(&input[i], block_size,
+                                              &output[i]);
+                                  for (auto &section : sections)
+                                      section_block(section, &output[i],
+                                                    block_size, 0);
+                              }
+                          },
+                          input.size()));
+    bench_sink(output);
+}
+
+int main() {
+    bench_cascade<8, BiQuadFilterDF1, float>("DF1", "float");
+    bench_cascade<8, BiQuadFilterDF2T, float>("DF2T", "float");
+    bench_cascade<10, BiQuadFilterDF1, float>("DF1", "float");
+    bench_cascade<10, BiQuadFilterDF2T, float>("DF2T", "float");
+    bench_cascade<12, BiQuadFilterDF1, float>("DF1", "float");
+    bench_cascade<12, BiQuadFilterDF2T, float>("DF2T", "float");
+    bench_cascade<12, BiQuadFilterDF1, double>("DF1", "double");
+    bench_cascade<12, BiQuadFilterDF2T, double>("DF2T", "double");
+}
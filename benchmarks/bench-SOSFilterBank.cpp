@@ -0,0 +1,62 @@
+/**
+ * Compare the throughput of C separate SOSFilter instances and a single
+ * SOSFilterBank for different numbers of channels.
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/Butterworth.hpp>
+#include <Filters/SOSFilterBank.hpp>
+
+template <size_t C, class T>
+void bench_bank(const char *type) {
+    constexpr uint8_t Order = 8;
+    constexpr size_t N = (Order + 1) / 2;
+    auto coeff = butter_coeff<Order, T>(0.1);
+
+    const size_t frames = 1 << 13;
+    auto input = bench_signal<T>(frames * C);
+    std::vector<T> output(input.size());
+
+    std::vector<SOSFilter<T, N>> filters(C, coeff);
+    double separate = bench_throughput(
+        [&] {
+            for (size_t f = 0; f < frames; ++f)
+                for (size_t c = 0; c < C; ++c)
+                    output[f * C + c] = filters[c](input[f * C + c]);
+        },
+        input.size());
+    bench_sink(output);
+
+    SOSFilterBank<T, N, C> bank = coeff;
+    double framewise = bench_throughput(
+        [&] {
+            for (size_t f = 0; f < frames; ++f)
+                bank(&input[f * C], &output[f * C]);
+        },
+        input.size());
+    bench_sink(output);
+
+    double block = bench_throughput(
+        [&] { bank.process(input.data(), output.data(), frames); },
+        input.size());
+    bench_sink(output);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%zu x SOSFilter<%s, %zu>", C, type, N);
+    bench_print(name, separate, C * sizeof(SOSFilter<T, N>));
+    std::snprintf(name, sizeof(name), "SOSFilterBank<%s, %zu, %zu>", type, N,
+                  C);
+    bench_print(name, framewise, sizeof(SOSFilterBank<T, N, C>));
+    std::snprintf(name, sizeof(name), "SOSFilterBank<%s, %zu, %zu>::process",
+                  type, N, C);
+    bench_print(name, block);
+}
+
+int main() {
+    bench_bank<4, float>("float");
+    bench_bank<8, float>("float");
+    bench_bank<16, float>("float");
+    bench_bank<4, double>("double");
+    bench_bank<16, double>("double");
+}
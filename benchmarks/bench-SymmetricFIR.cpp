@@ -0,0 +1,39 @@
+/**
+ * Compare the throughput of FIRFilter and SymmetricFIRFilter for different
+ * filter lengths.
+ */
+
+#include "Benchmark.hpp"
+
+#include <Filters/FIRFilter.hpp>
+#include <Filters/SymmetricFIRFilter.hpp>
+
+template <uint8_t N, class T>
+void bench_symmetric(const char *type) {
+    constexpr uint8_t H = (N + 1) / 2;
+    AH::Array<T, H> half;
+    AH::Array<T, N> full;
+    for (uint8_t i = 0; i < H; ++i)
+        half[i] = T(i % 5 + 1) / T(N);
+    for (uint8_t i = 0; i < N; ++i)
+        full[i] = i < H ? half[i] : half[N - 1 - i];
+
+    auto input = bench_signal<T>(1 << 16);
+    char name[64];
+    std::snprintf(name, sizeof(name), "FIRFilter<%d, %s>", N, type);
+    bench_print(name, bench_filter(FIRFilter<N, T>{full}, input),
+                sizeof(FIRFilter<N, T>));
+    std::snprintf(name, sizeof(name), "SymmetricFIRFilter<%d, %s>", N, type);
+    bench_print(name, bench_filter(SymmetricFIRFilter<N, T>{half}, input),
+                sizeof(SymmetricFIRFilter<N, T>));
+}
+
+int main() {
+    bench_symmetric<7, float>("float");
+    bench_symmetric<16, float>("float");
+    bench_symmetric<31, float>("float");
+    bench_symmetric<64, float>("float");
+    bench_symmetric<127, float>("float");
+    bench_symmetric<31, int32_t>("int32_t");
+    bench_symmetric<127, int32_t>("int32_t");
+}
@@ -135,6 +135,124 @@ class EMA {
 
 // -------------------------------------------------------------------------- //
 
+/// Number of channels of an @ref EMABank that are updated together. On 8-bit
+/// AVR, there are no vector units, so the channels are updated one by one to
+/// keep the stack usage to a minimum.
+#ifndef AH_EMA_BANK_LANES
+#ifdef __AVR__
+#define AH_EMA_BANK_LANES 1
+#else
+#define AH_EMA_BANK_LANES 16
+#endif
+#endif
+
+/**
+ * @brief   Bank of @p C identical exponential moving average filters, one for
+ *          each channel of a multi-channel signal.
+ *
+ * Each channel performs exactly the same integer operations as an instance
+ * of @ref EMA with the same template parameters, so the outputs are
+ * bit-identical, but the states of all channels are stored contiguously and
+ * all channels are updated at once, from a frame of @p C inputs.
+ *
+ * The channels are updated in groups of @ref lanes (16 by default), through
+ * small local arrays, so the compiler can vectorize the additions and
+ * shifts without having to worry about aliasing between the inputs, the
+ * outputs and the state. With SSE2, AVX2 or NEON and optimizations enabled,
+ * this processes 4 to 16 channels per instruction, depending on the width of
+ * @p state_t.
+ *
+ * @tparam  K
+ *          The amount of bits to shift by, see @ref EMA.
+ * @tparam  C
+ *          The number of channels.
+ * @tparam  input_t
+ *          The integer type to use for the input and output of the filter,
+ *          see @ref EMA.
+ * @tparam  state_t
+ *          The unsigned integer type to use for the internal state of the
+ *          filter, see @ref EMA.
+ *
+ * @ingroup    AH_Filters
+ */
+template <uint8_t K, uint16_t C,
+          class input_t = uint_fast16_t,
+          class state_t = typename std::make_unsigned<input_t>::type>
+class EMABank {
+  public:
+    /// The scalar filter that is applied to each channel.
+    using EMA_t = EMA<K, input_t, state_t>;
+    /// The number of channels that are updated together.
+    constexpr static uint16_t lanes = AH_EMA_BANK_LANES;
+
+    /// Constructor: initialize all channels to zero or optional given value.
+    EMABank(input_t initial = input_t(0)) { reset(initial); }
+
+    /**
+     * @brief   Reset all channels to the given value.
+     * 
+     * @param   value 
+     *          The value to reset the filter states to.
+     */
+    void reset(input_t value = input_t(0)) {
+        for (state_t &s : state)
+            s = EMA_t::zero + (state_t(value) << K) - value;
+    }
+
+    /**
+     * @brief   Filter a frame of inputs: Given @f$ x_c[n] @f$, calculate
+     *          @f$ y_c[n] @f$ for all channels @f$ c @f$.
+     *
+     * @param   input
+     *          Pointer to the @p C new raw input values.
+     * @param   output
+     *          Pointer to where the @p C new filtered output values should be
+     *          stored. May be equal to @p input.
+     */
+    void filter(const input_t *input, input_t *output) {
+        uint16_t c = 0;
+        for (; c + lanes <= C; c += lanes)
+            filterGroup<lanes>(input + c, output + c, state + c);
+        if (C % lanes != 0)
+            filterGroup<(C % lanes != 0 ? C % lanes : 1)>(input + c,
+                                                          output + c,
+                                                          state + c);
+    }
+
+    /// @copydoc    EMABank::filter(const input_t *, input_t *)
+    void operator()(const input_t *input, input_t *output) {
+        filter(input, output);
+    }
+
+    /// @copydoc    EMA::supports_range
+    template <class T>
+    constexpr static bool supports_range(T min, T max) {
+        return EMA_t::supports_range(min, max);
+    }
+
+  private:
+    /// Update the @p L channels starting at the given pointers.
+    template <uint16_t L>
+    static void filterGroup(const input_t *input, input_t *output,
+                            state_t *state) {
+        constexpr state_t zero = EMA_t::zero, half = EMA_t::half;
+        state_t s[L], y[L];
+        for (uint16_t i = 0; i < L; ++i)
+            s[i] = state[i] + state_t(input[i]);
+        for (uint16_t i = 0; i < L; ++i) {
+            y[i] = ((s[i] + half) >> K) - (zero >> K);
+            state[i] = s[i] - y[i];
+        }
+        for (uint16_t i = 0; i < L; ++i)
+            output[i] = input_t(y[i]);
+    }
+
+  private:
+    state_t state[C];
+};
+
+// -------------------------------------------------------------------------- //
+
 /**
  * @brief   A class for single-pole infinite impulse response filters
  *          or exponential moving average filters.
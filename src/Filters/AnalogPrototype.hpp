@@ -0,0 +1,354 @@
+#pragma once
+
+#include <AH/STL/algorithm>
+#include <AH/STL/cmath>
+#include <AH/STL/complex>
+#include <Filters/SOSFilter.hpp>
+
+/// @addtogroup FilterDesign
+/// @{
+
+/**
+ * @brief   Poles and zeros of an analog low-pass prototype filter of order
+ *          @p N, with a cut-off frequency of @f$ 1\ \mathrm{rad/s} @f$.
+ *
+ * Only one pole of every complex conjugate pair is stored. If @p N is odd,
+ * the last pole is the single real pole. All zeros are on the imaginary axis
+ * (or at infinity), so only their positive imaginary parts
+ * @f$ \omega_k @f$ are stored, each one representing the pair of zeros
+ * @f$ \pm j \omega_k @f$.
+ */
+template <uint8_t N>
+struct AnalogPrototype {
+    /// One pole of each complex conjugate pair, followed by the real pole if
+    /// @p N is odd.
+    std::complex<double> poles[(N + 1) / 2];
+    /// Imaginary parts of the finite zeros, the first @ref num_zeros are used,
+    /// all other zeros are at infinity.
+    double zeros[N / 2 > 0 ? N / 2 : 1];
+    /// The number of pairs of finite zeros.
+    uint8_t num_zeros = 0;
+    /// The gain of the filter at DC.
+    double dc_gain = 1;
+};
+
+/// @cond HIDDEN_SYMBOLS
+
+/// The bilinear transform @f$ z = \frac{1 + s}{1 - s} @f$, for analog
+/// frequencies that were pre-warped using
+/// @f$ \omega = \tan\left(\pi f_n / 2\right) @f$.
+inline std::complex<double> prewarped_bilinear(std::complex<double> s) {
+    return (1. + s) / (1. - s);
+}
+
+/// The roots of the numerator or the denominator of a single section in the
+/// z-domain: a complex conjugate pair, two real roots, or a single real root
+/// (with the second root at the origin) for first order sections.
+struct SectionRoots {
+    SectionRoots() = default;
+    SectionRoots(std::complex<double> r1, std::complex<double> r2)
+        : r1(r1), r2(r2) {}
+
+    std::complex<double> r1 = 0, r2 = 0;
+
+    /// A complex conjugate pair of roots.
+    static SectionRoots conjugatePair(std::complex<double> r) {
+        return {r, std::conj(r)};
+    }
+    /// The coefficient of @f$ z^{-1} @f$ of
+    /// @f$ (1 - r_1 z^{-1})(1 - r_2 z^{-1}) @f$.
+    double c1() const { return -(r1 + r2).real(); }
+    /// The coefficient of @f$ z^{-2} @f$ of
+    /// @f$ (1 - r_1 z^{-1})(1 - r_2 z^{-1}) @f$.
+    double c2() const { return (r1 * r2).real(); }
+    /// Evaluate @f$ (1 - r_1 z^{-1})(1 - r_2 z^{-1}) @f$.
+    std::complex<double> operator()(std::complex<double> z) const {
+        return (1. - r1 / z) * (1. - r2 / z);
+    }
+    /// The largest magnitude of the two roots.
+    double radius() const { return std::max(std::abs(r1), std::abs(r2)); }
+    /// The distance from @p p (in the upper half plane) to the nearest root
+    /// mirrored into the upper half plane.
+    double distance(std::complex<double> p) const {
+        auto upper = [](std::complex<double> r) {
+            return std::complex<double>{r.real(), std::abs(r.imag())};
+        };
+        return std::min(std::abs(upper(r1) - p), std::abs(upper(r2) - p));
+    }
+};
+
+/**
+ * @brief   Pair the poles and zeros, order the sections, and compute the
+ *          normalized coefficients.
+ *
+ * The sections are built and ordered to keep the intermediate signals small,
+ * like SciPy's `zpk2sos`: the first order section (if any) comes first, then
+ * the second order sections in order of increasing pole radius, so the
+ * sections with the sharpest resonance are at the end of the cascade. Each
+ * pair of poles, starting from the one closest to the unit circle, is
+ * combined with the nearest remaining pair of zeros. Every section is scaled
+ * to unity gain at @p z_ref, and @p gain is applied to the first section.
+ *
+ * @param   poles
+ *          The poles of each section, the order is changed by this function.
+ * @param   zeros
+ *          The zeros of each section, in any order.
+ * @param   first_order
+ *          If true, `poles[0]` and `zeros[0]` form a first order section, they
+ *          are excluded from the pairing.
+ * @param   z_ref
+ *          The point on the unit circle where the gain is normalized: the
+ *          center of the pass band.
+ * @param   gain
+ *          The overall gain of the filter at @p z_ref.
+ */
+template <class T, uint8_t S>
+SOSCoefficients<T, S> roots2sos(SectionRoots (&poles)[S],
+                                const SectionRoots (&zeros)[S],
+                                bool first_order, std::complex<double> z_ref,
+                                double gain) {
+    const uint8_t F = first_order;
+    // Sort the second order sections by increasing pole radius.
+    for (uint8_t k = F + 1; k < S; ++k) {
+        const SectionRoots p = poles[k];
+        uint8_t i = k;
+        for (; i > F && poles[i - 1].radius() > p.radius(); --i)
+            poles[i] = poles[i - 1];
+        poles[i] = p;
+    }
+    SOSCoefficients<T, S> sections;
+    auto make_section = [&](const SectionRoots &p, const SectionRoots &z) {
+        const double g = std::abs(p(z_ref) / z(z_ref));
+        return BiQuadCoefficients<T>{
+            {{T(g), T(g * z.c1()), T(g * z.c2())}},
+            {{T(1), T(p.c1()), T(p.c2())}},
+        };
+    };
+    if (F)
+        sections[0] = make_section(poles[0], zeros[0]);
+    // Pair the poles closest to the unit circle first.
+    bool used[S] = {};
+    for (uint8_t k = S; k-- > F;) {
+        // Compare the zeros to the pole of the pair that's in the upper half
+        // plane (or the outermost one if both poles are real).
+        const SectionRoots &p = poles[k];
+        const std::complex<double> dominant =
+            std::abs(p.r1) >= std::abs(p.r2) ? p.r1 : p.r2;
+        const std::complex<double> p_upper = {dominant.real(),
+                                              std::abs(dominant.imag())};
+        auto distance = [&](uint8_t j) { return zeros[j].distance(p_upper); };
+        uint8_t nearest = S;
+        for (uint8_t j = F; j < S; ++j)
+            if (!used[j] && (nearest == S || distance(j) < distance(nearest)))
+                nearest = j;
+        used[nearest] = true;
+        sections[k] = make_section(p, zeros[nearest]);
+    }
+    // Apply the overall gain to the first section.
+    for (auto &b : sections[0].b)
+        b = T(double(b) * gain);
+    return sections;
+}
+
+/// Map the prototype to a digital low-pass or high-pass filter, see
+/// @ref analog_prototype2sos and @ref analog_prototype2sos_highpass.
+template <class T, uint8_t N>
+SOSCoefficients<T, (N + 1) / 2>
+analog_prototype2sos_lp_hp(const AnalogPrototype<N> &proto, double f_n,
+                           bool highpass) {
+    using complex_t = std::complex<double>;
+    constexpr uint8_t P = N / 2; // number of pole pairs
+    constexpr uint8_t F = N % 2; // number of first order sections
+    const double w = std::tan(M_PI * f_n / 2); // pre-warped cut-off frequency
+    // Low-pass: s → s / ω, high-pass: s → ω / s
+    auto transform = [w, highpass](complex_t s) {
+        return prewarped_bilinear(highpass ? w / s : w * s);
+    };
+    // Zeros at infinity end up at s = ∞ or s = 0, i.e. z = -1 or z = +1.
+    const double z_inf = highpass ? 1 : -1;
+
+    SectionRoots poles[P + F], zeros[P + F];
+    if (F) {
+        poles[0] = SectionRoots{transform(proto.poles[P]), 0};
+        zeros[0] = SectionRoots{z_inf, 0};
+    }
+    for (uint8_t k = 0; k < P; ++k) {
+        poles[F + k] = SectionRoots::conjugatePair(transform(proto.poles[k]));
+        zeros[F + k] =
+            k < proto.num_zeros
+                ? SectionRoots::conjugatePair(
+                      transform(complex_t(0, proto.zeros[k])))
+                : SectionRoots{z_inf, z_inf};
+    }
+    return roots2sos<T>(poles, zeros, F, highpass ? -1 : 1, proto.dc_gain);
+}
+
+/// Map the prototype to a digital band-pass or band-stop filter, see
+/// @ref analog_prototype2sos_bandpass and @ref analog_prototype2sos_bandstop.
+template <class T, uint8_t N>
+SOSCoefficients<T, N>
+analog_prototype2sos_bp_bs(const AnalogPrototype<N> &proto, double f_low,
+                           double f_high, bool bandstop) {
+    using complex_t = std::complex<double>;
+    constexpr uint8_t P = N / 2; // number of pole pairs
+    constexpr uint8_t F = N % 2; // number of real poles
+    // Pre-warped band edges, center frequency and bandwidth
+    const double w1 = std::tan(M_PI * f_low / 2);
+    const double w2 = std::tan(M_PI * f_high / 2);
+    const double w0_sq = w1 * w2, bw = w2 - w1;
+    // Band-pass: s → (s² + ω₀²) / (B s), band-stop: s → B s / (s² + ω₀²).
+    // Every root r of the prototype results in the two roots of
+    // s² - 2 q s + ω₀², with q = B r / 2 or q = B / (2 r) respectively.
+    auto transform = [=](complex_t r, complex_t &s1, complex_t &s2) {
+        const complex_t q = bandstop ? bw / (2. * r) : bw * r / 2.;
+        const complex_t d = std::sqrt(q * q - w0_sq);
+        s1 = prewarped_bilinear(q + d), s2 = prewarped_bilinear(q - d);
+    };
+
+    SectionRoots poles[N], zeros[N];
+    complex_t s1, s2;
+    // Each pair of complex conjugate poles results in two pairs.
+    for (uint8_t k = 0; k < P; ++k) {
+        transform(proto.poles[k], s1, s2);
+        poles[2 * k] = SectionRoots::conjugatePair(s1);
+        poles[2 * k + 1] = SectionRoots::conjugatePair(s2);
+    }
+    // A real pole results in a single pair (real or complex conjugate).
+    if (F) {
+        transform(proto.poles[P], s1, s2);
+        poles[N - 1] = {s1, s2};
+    }
+    // Each pair of finite zeros on the imaginary axis results in two pairs.
+    uint8_t j = 0;
+    for (; j < 2 * proto.num_zeros; j += 2) {
+        transform(complex_t(0, proto.zeros[j / 2]), s1, s2);
+        zeros[j] = SectionRoots::conjugatePair(s1);
+        zeros[j + 1] = SectionRoots::conjugatePair(s2);
+    }
+    // Zeros at infinity end up at s = 0 and s = ∞ (z = ±1) for band-pass
+    // filters, and at s = ±jω₀ for band-stop filters.
+    const complex_t z_center =
+        prewarped_bilinear(complex_t(0, std::sqrt(w0_sq)));
+    for (; j < N; ++j)
+        zeros[j] = bandstop ? SectionRoots::conjugatePair(z_center)
+                            : SectionRoots{1, -1};
+    return roots2sos<T>(poles, zeros, false, bandstop ? 1 : z_center,
+                        proto.dc_gain);
+}
+
+/// @endcond
+
+/**
+ * @brief   Convert an analog low-pass prototype to a digital low-pass filter in
+ *          Second Order Sections form, using the bilinear transform.
+ *
+ * The prototype is scaled to the pre-warped cut-off frequency, and then
+ * mapped to the z-plane using the bilinear transform, zeros at infinity end up
+ * at @f$ z = -1 @f$.
+ *
+ * The sections are built and ordered to keep the intermediate signals small,
+ * like SciPy's `zpk2sos`: the first order section (if any) comes first, then
+ * the second order sections in order of increasing pole radius, so the
+ * sections with the sharpest resonance are at the end of the cascade. Each
+ * pair of poles, starting from the one closest to the unit circle, is
+ * combined with the nearest remaining pair of zeros. Every section is scaled
+ * to unity gain at DC, and the overall DC gain of the prototype is applied to
+ * the first section.
+ *
+ * @param   proto
+ *          The analog prototype.
+ * @param   f_n
+ *          Normalized cut-off frequency in half-cycles per sample.
+ * @return  The normalized coefficients (@f$ a_0 = 1 @f$) of the
+ *          @f$ \lceil N/2 \rceil @f$ sections.
+ */
+template <class T, uint8_t N>
+SOSCoefficients<T, (N + 1) / 2>
+analog_prototype2sos(const AnalogPrototype<N> &proto, double f_n) {
+    return analog_prototype2sos_lp_hp<T>(proto, f_n, false);
+}
+
+/**
+ * @brief   Convert an analog low-pass prototype to a digital high-pass filter
+ *          in Second Order Sections form.
+ *
+ * Uses the low-pass to high-pass transformation
+ * @f$ s \rightarrow \omega_c / s @f$ followed by the bilinear transform, so
+ * zeros at infinity end up at @f$ z = +1 @f$. The sections are paired and
+ * ordered like @ref analog_prototype2sos, and scaled to unity gain at the
+ * Nyquist frequency.
+ *
+ * @param   proto
+ *          The analog prototype.
+ * @param   f_n
+ *          Normalized cut-off frequency in half-cycles per sample.
+ * @return  The normalized coefficients (@f$ a_0 = 1 @f$) of the
+ *          @f$ \lceil N/2 \rceil @f$ sections.
+ */
+template <class T, uint8_t N>
+SOSCoefficients<T, (N + 1) / 2>
+analog_prototype2sos_highpass(const AnalogPrototype<N> &proto, double f_n) {
+    return analog_prototype2sos_lp_hp<T>(proto, f_n, true);
+}
+
+/**
+ * @brief   Convert an analog low-pass prototype to a digital band-pass filter
+ *          of order @f$ 2N @f$ in Second Order Sections form.
+ *
+ * Uses the low-pass to band-pass transformation
+ * @f$ s \rightarrow \frac{s^2 + \omega_0^2}{B s} @f$, with
+ * @f$ \omega_0^2 = \omega_{low} \omega_{high} @f$ and
+ * @f$ B = \omega_{high} - \omega_{low} @f$ (all pre-warped), followed by the
+ * bilinear transform. Every pole of the prototype results in one section,
+ * which is the minimum: a cascade of a low-pass and a high-pass filter of
+ * order @p N has the same number of sections for even @p N, and one more for
+ * odd @p N, with a wider transition band.
+ *
+ * The sections are paired and ordered like @ref analog_prototype2sos, and
+ * scaled to unity gain at the center frequency @f$ \omega_0 @f$.
+ *
+ * @param   proto
+ *          The analog prototype.
+ * @param   f_low
+ *          Normalized lower cut-off frequency in half-cycles per sample.
+ * @param   f_high
+ *          Normalized upper cut-off frequency in half-cycles per sample.
+ * @return  The normalized coefficients (@f$ a_0 = 1 @f$) of the @f$ N @f$
+ *          sections.
+ */
+template <class T, uint8_t N>
+SOSCoefficients<T, N>
+analog_prototype2sos_bandpass(const AnalogPrototype<N> &proto, double f_low,
+                              double f_high) {
+    return analog_prototype2sos_bp_bs<T>(proto, f_low, f_high, false);
+}
+
+/**
+ * @brief   Convert an analog low-pass prototype to a digital band-stop filter
+ *          of order @f$ 2N @f$ in Second Order Sections form.
+ *
+ * Uses the low-pass to band-stop transformation
+ * @f$ s \rightarrow \frac{B s}{s^2 + \omega_0^2} @f$, followed by the
+ * bilinear transform, zeros at infinity end up at the center frequency
+ * @f$ \omega_0 @f$ of the stop band. See
+ * @ref analog_prototype2sos_bandpass for the definitions. The sections are
+ * paired and ordered like @ref analog_prototype2sos, and scaled to unity gain
+ * at DC.
+ *
+ * @param   proto
+ *          The analog prototype.
+ * @param   f_low
+ *          Normalized lower edge of the stop band in half-cycles per sample.
+ * @param   f_high
+ *          Normalized upper edge of the stop band in half-cycles per sample.
+ * @return  The normalized coefficients (@f$ a_0 = 1 @f$) of the @f$ N @f$
+ *          sections.
+ */
+template <class T, uint8_t N>
+SOSCoefficients<T, N>
+analog_prototype2sos_bandstop(const AnalogPrototype<N> &proto, double f_low,
+                              double f_high) {
+    return analog_prototype2sos_bp_bs<T>(proto, f_low, f_high, true);
+}
+
+/// @}
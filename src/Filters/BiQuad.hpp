@@ -97,6 +97,15 @@ class NormalizingBiQuadFilterDF1 {
      */
     T operator()(T input) { return update(input, x, y, b, a); }
 
+    /**
+     * @brief   Replace the coefficients, without resetting the state of the
+     *          filter.
+     */
+    void setCoefficients(const BiQuadCoefficients<T> &coefficients) {
+        const NormalizingBiQuadFilterDF1 f{coefficients};
+        b = f.b, a = f.a;
+    }
+
   private:
     AH::Array<T, 2> x = {{}}; ///< Previous inputs
     AH::Array<T, 2> y = {{}}; ///< Previous outputs
@@ -182,6 +191,15 @@ class NonNormalizingBiQuadFilterDF1 {
      */
     T operator()(T input) { return update(input, x, y, b, a, a0); }
 
+    /**
+     * @brief   Replace the coefficients, without resetting the state of the
+     *          filter.
+     */
+    void setCoefficients(const BiQuadCoefficients<T> &coefficients) {
+        const NonNormalizingBiQuadFilterDF1 f{coefficients};
+        b = f.b, a = f.a, a0 = f.a0;
+    }
+
   private:
     AH::Array<T, 2> x = {{}}; ///< Previous inputs
     AH::Array<T, 2> y = {{}}; ///< Previous outputs
@@ -365,6 +383,15 @@ class NormalizingBiQuadFilterDF2 {
      */
     T operator()(T input) { return update(input, w, b, a); }
 
+    /**
+     * @brief   Replace the coefficients, without resetting the state of the
+     *          filter.
+     */
+    void setCoefficients(const BiQuadCoefficients<T> &coefficients) {
+        const NormalizingBiQuadFilterDF2 f{coefficients};
+        b = f.b, a = f.a;
+    }
+
   private:
     AH::Array<T, 2> w = {{}}; ///< Internal state
     AH::Array<T, 3> b = {{}}; ///< Numerator coefficients
@@ -447,6 +474,15 @@ class NonNormalizingBiQuadFilterDF2 {
      */
     T operator()(T input) { return update(input, w, b, a, a0); }
 
+    /**
+     * @brief   Replace the coefficients, without resetting the state of the
+     *          filter.
+     */
+    void setCoefficients(const BiQuadCoefficients<T> &coefficients) {
+        const NonNormalizingBiQuadFilterDF2 f{coefficients};
+        b = f.b, a = f.a, a0 = f.a0;
+    }
+
   private:
     AH::Array<T, 2> w = {{}}; ///< Internal state
     AH::Array<T, 3> b = {{}}; ///< Numerator coefficients
@@ -547,4 +583,330 @@ class BiQuadFilterDF2 : public BiQuadDF2Implementation<T> {
     }
 };
 
-/// @}
\ No newline at end of file
+/// @}
+
+// Transposed Direct Form 2 ::::::::::::::::::::::::::::::::::::::::::::::::::::
+
+/// @addtogroup FilterImplementations
+/// @{
+
+/** 
+ * @brief   BiQuad filter Transposed Direct Form 2 implementation that 
+ *          normalizes the coefficients upon initialization.
+ * 
+ * This class is faster than @ref NonNormalizingBiQuadFilterDF2T, because each 
+ * filter iteration involves only addition and multiplication, no divisions.  
+ * It works great for floating point numbers, but might be less ideal
+ * for integer types, because it can create large rounding errors on the 
+ * coefficients.
+ * 
+ * Like Direct Form 2, it only needs two state variables. The output only 
+ * depends on the input and a single state variable, so the recursive 
+ * dependency chain from one output to the next is only two operations long.
+ * 
+ * Implements the following difference equation:
+ * 
+ * @f[
+ * y[n] = \frac{b_0 \cdot x[n] + b_1 \cdot x[n-1] + b_2 \cdot x[n-2] 
+ *            - a_1 \cdot y[n-1] - a_2 \cdot y[n-2]}{a_0}
+ * @f]
+ */
+template <class T>
+class NormalizingBiQuadFilterDF2T {
+  public:
+    NormalizingBiQuadFilterDF2T() = default;
+
+    NormalizingBiQuadFilterDF2T(const AH::Array<T, 3> &b,
+                                const AH::Array<T, 3> &a)
+        : b(b / a[0]), a(-a.template slice<1, 2>() / a[0]) {}
+
+    NormalizingBiQuadFilterDF2T(const BiQuadCoefficients<T> &coefficients)
+        : NormalizingBiQuadFilterDF2T{coefficients.b, coefficients.a} {}
+
+    NormalizingBiQuadFilterDF2T(const AH::Array<T, 3> &b,
+                                const AH::Array<T, 3> &a, T gain)
+        : b(b * gain / a[0]), a(-a.template slice<1, 2>() / a[0]) {}
+
+    NormalizingBiQuadFilterDF2T(const BiQuadCoefficients<T> &coefficients,
+                                T gain)
+        : NormalizingBiQuadFilterDF2T{coefficients.b, coefficients.a, gain} {}
+
+    template <bool Enable = true>
+    static std::enable_if_t<std::is_floating_point<T>::value && Enable, T>
+    update(T input, AH::Array<T, 2> &s, const AH::Array<T, 3> &b,
+           const AH::Array<T, 2> &a) {
+        T output = std::fma(b[0], input, s[0]);
+        s[0] = std::fma(b[1], input, s[1]);
+        s[0] = std::fma(a[0], output, s[0]);
+        s[1] = b[2] * input;
+        s[1] = std::fma(a[1], output, s[1]);
+        return output;
+    }
+
+    template <bool Enable = true>
+    static std::enable_if_t<!std::is_floating_point<T>::value && Enable, T>
+    update(T input, AH::Array<T, 2> &s, const AH::Array<T, 3> &b,
+           const AH::Array<T, 2> &a) {
+        T output = b[0] * input + s[0];
+        s[0] = b[1] * input + s[1];
+        s[0] += a[0] * output;
+        s[1] = b[2] * input;
+        s[1] += a[1] * output;
+        return output;
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     * 
+     * @param   input 
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) { return update(input, s, b, a); }
+
+    /**
+     * @brief   Filter a block of @p n inputs at once.
+     * 
+     * Equivalent to calling @ref operator()() for each of the inputs, but 
+     * keeps the state and the coefficients in local variables for the 
+     * entire block.
+     * 
+     * @param   in 
+     *          Pointer to the @p n inputs.
+     * @param   out 
+     *          Pointer to where the @p n outputs should be stored. May be equal
+     *          to @p in.
+     * @param   n 
+     *          The number of samples to filter.
+     */
+    void process(const T *in, T *out, size_t n) {
+        AH::Array<T, 2> s = this->s;
+        const AH::Array<T, 3> b = this->b;
+        const AH::Array<T, 2> a = this->a;
+        for (size_t i = 0; i < n; ++i)
+            out[i] = update(in[i], s, b, a);
+        this->s = s;
+    }
+
+    /**
+     * @brief   Replace the coefficients, without resetting the state of the
+     *          filter.
+     */
+    void setCoefficients(const BiQuadCoefficients<T> &coefficients) {
+        const NormalizingBiQuadFilterDF2T f{coefficients};
+        b = f.b, a = f.a;
+    }
+
+  private:
+    AH::Array<T, 2> s = {{}}; ///< Internal state
+    AH::Array<T, 3> b = {{}}; ///< Numerator coefficients
+    AH::Array<T, 2> a = {{}}; ///< Denominator coefficients
+};
+
+/** 
+ * @brief   BiQuad filter Transposed Direct Form 2 implementation that does not 
+ *          normalize the coefficients upon initialization, the division by 
+ *          @f$ a_0 @f$ is carried out on each filter iteration.
+ * 
+ * This class is slower than @ref NormalizingBiQuadFilterDF2T, but it works 
+ * better for integer types, because it has no rounding error on the 
+ * coefficients.
+ * 
+ * Implements the following difference equation:
+ * 
+ * @f[
+ * y[n] = \frac{b_0 \cdot x[n] + b_1 \cdot x[n-1] + b_2 \cdot x[n-2] 
+ *            - a_1 \cdot y[n-1] - a_2 \cdot y[n-2]}{a_0}
+ * @f]
+ */
+template <class T>
+class NonNormalizingBiQuadFilterDF2T {
+  public:
+    NonNormalizingBiQuadFilterDF2T() = default;
+
+    NonNormalizingBiQuadFilterDF2T(const AH::Array<T, 3> &b,
+                                   const AH::Array<T, 3> &a)
+        : b(b), a(-a.template slice<1, 2>()), a0(a[0]) {}
+
+    NonNormalizingBiQuadFilterDF2T(const BiQuadCoefficients<T> &coefficients)
+        : NonNormalizingBiQuadFilterDF2T{coefficients.b, coefficients.a} {}
+
+    NonNormalizingBiQuadFilterDF2T(const AH::Array<T, 3> &b,
+                                   const AH::Array<T, 3> &a, T gain)
+        : b(b * gain), a(-a.template slice<1, 2>()), a0(a[0]) {}
+
+    NonNormalizingBiQuadFilterDF2T(const BiQuadCoefficients<T> &coefficients,
+                                   T gain)
+        : NonNormalizingBiQuadFilterDF2T{coefficients.b, coefficients.a,
+                                         gain} {}
+
+    template <bool Enable = true>
+    static std::enable_if_t<std::is_floating_point<T>::value && Enable, T>
+    update(T input, AH::Array<T, 2> &s, const AH::Array<T, 3> &b,
+           const AH::Array<T, 2> &a, T a0) {
+        T output = std::fma(b[0], input, s[0]) / a0;
+        s[0] = std::fma(b[1], input, s[1]);
+        s[0] = std::fma(a[0], output, s[0]);
+        s[1] = b[2] * input;
+        s[1] = std::fma(a[1], output, s[1]);
+        return output;
+    }
+
+    template <bool Enable = true>
+    static std::enable_if_t<!std::is_floating_point<T>::value && Enable, T>
+    update(T input, AH::Array<T, 2> &s, const AH::Array<T, 3> &b,
+           const AH::Array<T, 2> &a, T a0) {
+        T output = (b[0] * input + s[0]) / a0;
+        s[0] = b[1] * input + s[1];
+        s[0] += a[0] * output;
+        s[1] = b[2] * input;
+        s[1] += a[1] * output;
+        return output;
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     * 
+     * @param   input 
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) { return update(input, s, b, a, a0); }
+
+    /**
+     * @brief   Filter a block of @p n inputs at once.
+     * 
+     * Equivalent to calling @ref operator()() for each of the inputs, but 
+     * keeps the state and the coefficients in local variables for the 
+     * entire block.
+     * 
+     * @param   in 
+     *          Pointer to the @p n inputs.
+     * @param   out 
+     *          Pointer to where the @p n outputs should be stored. May be equal
+     *          to @p in.
+     * @param   n 
+     *          The number of samples to filter.
+     */
+    void process(const T *in, T *out, size_t n) {
+        AH::Array<T, 2> s = this->s;
+        const AH::Array<T, 3> b = this->b;
+        const AH::Array<T, 2> a = this->a;
+        const T a0 = this->a0;
+        for (size_t i = 0; i < n; ++i)
+            out[i] = update(in[i], s, b, a, a0);
+        this->s = s;
+    }
+
+    /**
+     * @brief   Replace the coefficients, without resetting the state of the
+     *          filter.
+     */
+    void setCoefficients(const BiQuadCoefficients<T> &coefficients) {
+        const NonNormalizingBiQuadFilterDF2T f{coefficients};
+        b = f.b, a = f.a, a0 = f.a0;
+    }
+
+  private:
+    AH::Array<T, 2> s = {{}}; ///< Internal state
+    AH::Array<T, 3> b = {{}}; ///< Numerator coefficients
+    AH::Array<T, 2> a = {{}}; ///< Denominator coefficients
+    T a0 = T(1.);             ///< First denominator coefficient
+};
+
+/// @}
+
+/// Select the @ref NormalizingBiQuadFilterDF2T implementation if @p T is a 
+/// floating point type, @ref NonNormalizingBiQuadFilterDF2T otherwise.
+template <class T>
+using BiQuadDF2TImplementation =
+    typename std::conditional<std::is_floating_point<T>::value,
+                              NormalizingBiQuadFilterDF2T<T>,
+                              NonNormalizingBiQuadFilterDF2T<T>>::type;
+
+/// @addtogroup Filters
+/// @{
+
+/** 
+ * @brief   Generic BiQuad (Bi-Quadratic) filter class, Transposed Direct Form 2
+ *          implementation.
+ * 
+ * Uses the @ref NormalizingBiQuadFilterDF2T implementation for floating point 
+ * types, and @ref NonNormalizingBiQuadFilterDF2T for all other types. 
+ * 
+ * Implements the following difference equation:
+ * 
+ * @f[
+ * y[n] = \frac{b_0 \cdot x[n] + b_1 \cdot x[n-1] + b_2 \cdot x[n-2] 
+ *            - a_1 \cdot y[n-1] - a_2 \cdot y[n-2]}{a_0}
+ * @f]
+ */
+template <class T = float>
+class BiQuadFilterDF2T : public BiQuadDF2TImplementation<T> {
+  public:
+    BiQuadFilterDF2T() = default;
+
+    /**
+     * @brief   Construct a new BiQuad (Bi-Quadratic) Filter object.
+     * 
+     * The coefficients @f$ b @f$ and @f$ a @f$ can be derived from the transfer
+     * function:
+     * 
+     * @f[
+     * H(z) = \frac{b_0 + b_1 z^{-1} + b_2 z ^{-2}}
+     *             {a_0 + a_1 z^{-1} + a_2 z ^{-2}}
+     * @f]
+     * 
+     * @param   b_coefficients 
+     *          The coefficients of the transfer function numerator.
+     * @param   a_coefficients 
+     *          The coefficients of the transfer function denominator.
+     */
+    BiQuadFilterDF2T(const AH::Array<T, 3> &b_coefficients,
+                     const AH::Array<T, 3> &a_coefficients)
+        : BiQuadDF2TImplementation<T>{b_coefficients, a_coefficients} {}
+
+    BiQuadFilterDF2T(const BiQuadCoefficients<T> &coefficients)
+        : BiQuadDF2TImplementation<T>{coefficients} {}
+
+    /**
+     * @brief   Construct a new BiQuad (Bi-Quadratic) Filter object.
+     * 
+     * The coefficients @f$ b @f$ and @f$ a @f$ can be derived from the transfer
+     * function:
+     * 
+     * @f[
+     * H(z) = K \frac{b_0 + b_1 z^{-1} + b_2 z ^{-2}}
+     *               {a_0 + a_1 z^{-1} + a_2 z ^{-2}}
+     * @f]
+     * 
+     * @param   b_coefficients 
+     *          The coefficients of the transfer function numerator.
+     * @param   a_coefficients 
+     *          The coefficients of the transfer function denominator.
+     * @param   gain
+     *          Gain factor @f$ K @f$.
+     */
+    BiQuadFilterDF2T(const AH::Array<T, 3> &b_coefficients,
+                     const AH::Array<T, 3> &a_coefficients, T gain)
+        : BiQuadDF2TImplementation<T>{b_coefficients, a_coefficients, gain} {}
+
+    BiQuadFilterDF2T(const BiQuadCoefficients<T> &coefficients, T gain)
+        : BiQuadDF2TImplementation<T>{coefficients, gain} {}
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     * 
+     * @param   input 
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        return BiQuadDF2TImplementation<T>::operator()(input);
+    }
+};
+
+/// @}
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/algorithm>
+#include <AH/STL/type_traits>
+#include <Filters/SIMD.hpp>
+#include <Filters/TransferFunction.hpp>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Infinite Impulse Response filter that computes blocks of @p K
+ *          outputs at once, using a state-space formulation of the recursion.
+ *
+ * Implements the same difference equation as @ref IIRFilter:
+ *
+ * @f[
+ * y[n] = \frac{1}{a_0} \left(\sum_{i=0}^{N_b-1} b_i \cdot x[n-i]
+ *                          - \sum_{i=1}^{N_a-1} a_i \cdot y[n-i] \right)
+ * @f]
+ *
+ * The throughput of a sample-by-sample IIR filter is limited by the latency
+ * of the feedback loop: every output has to wait for the previous one.
+ * This class uses the Transposed Direct Form 2 state @f$ s[n] @f$ of
+ * dimension @p P as a state-space model
+ * @f$ s[n+1] = A s[n] + B x[n] @f$, @f$ y[n] = C s[n] + D x[n] @f$,
+ * and advances it by @p K samples at once:
+ *
+ * @f[
+ * \begin{aligned}
+ * \begin{pmatrix} y[n] \\ \vdots \\ y[n+K-1] \end{pmatrix} &=
+ * \begin{pmatrix} C \\ \vdots \\ C A^{K-1} \end{pmatrix} s[n] +
+ * \begin{pmatrix} h_0 & & \\ \vdots & \ddots & \\ h_{K-1} & \cdots & h_0
+ * \end{pmatrix}
+ * \begin{pmatrix} x[n] \\ \vdots \\ x[n+K-1] \end{pmatrix} \\
+ * s[n+K] &= A^K s[n] +
+ * \begin{pmatrix} A^{K-1} B & \cdots & B \end{pmatrix}
+ * \begin{pmatrix} x[n] \\ \vdots \\ x[n+K-1] \end{pmatrix}
+ * \end{aligned}
+ * @f]
+ *
+ * where @f$ h_k @f$ is the impulse response. The matrices are computed in
+ * double precision upon construction. All @p K outputs of a block are
+ * independent of each other, so they are computed using SIMD instructions,
+ * and the only recursive dependency left is the state update, once per
+ * block. In exchange, the number of operations per sample grows from
+ * roughly @f$ 2P @f$ to @f$ (K + 1)/2 + 2P + P^2 / K @f$.
+ *
+ * Use @ref process() to filter blocks of samples, @ref operator()() uses
+ * the regular sample-by-sample recursion with the same state, so both can be
+ * mixed freely. Because of the different order of operations, the results
+ * are not bit-identical to the sample-by-sample recursion.
+ *
+ * @tparam  P
+ *          The order of the filter (the number of states),
+ *          @f$ \max(N_b, N_a) - 1 @f$.
+ * @tparam  K
+ *          The number of outputs per block.
+ * @tparam  T
+ *          The floating point type of the signals and coefficients.
+ */
+template <size_t P, size_t K = 8, class T = float>
+class BlockIIRFilter {
+    static_assert(std::is_floating_point<T>::value,
+                  "BlockIIRFilter requires a floating point type");
+    static_assert(P > 0 && K > 0, "");
+
+    using Pack = SIMDPack<T>;
+
+  public:
+    /// The number of outputs computed per block by @ref process().
+    constexpr static size_t block_size = K;
+
+    /**
+     * @brief   Construct a new Block IIR Filter object.
+     *
+     * @param   tf
+     *          The transfer function, with at most @f$ P + 1 @f$ numerator
+     *          and denominator coefficients.
+     */
+    template <size_t NB, size_t NA>
+    BlockIIRFilter(const TransferFunction<NB, NA, T> &tf) {
+        static_assert(NB <= P + 1 && NA <= P + 1,
+                      "Order of the transfer function is too high");
+        double b[P + 1] = {}, a[P + 1] = {};
+        for (size_t i = 0; i < NB; ++i)
+            b[i] = double(tf.b[i]) / double(tf.a[0]);
+        for (size_t i = 0; i < NA; ++i)
+            a[i] = double(tf.a[i]) / double(tf.a[0]);
+
+        // Transposed Direct Form 2: A has -a in the first column and ones
+        // on the superdiagonal, C selects the first state, D = b₀.
+        double A[P][P] = {}, B[P];
+        for (size_t i = 0; i < P; ++i) {
+            A[i][0] = -a[i + 1];
+            if (i + 1 < P)
+                A[i][i + 1] = 1;
+            B[i] = b[i + 1] - a[i + 1] * b[0];
+            this->b[i] = T(b[i + 1]);
+            this->a[i] = T(-a[i + 1]);
+        }
+        b0 = T(b[0]);
+        auto mul = [&](const double *v, double *r) { // r = A v
+            for (size_t i = 0; i < P; ++i) {
+                r[i] = 0;
+                for (size_t j = 0; j < P; ++j)
+                    r[i] += A[i][j] * v[j];
+            }
+        };
+
+        // Observability matrix: rows C Aᵏ, stored column-major.
+        double c[P] = {1}, cA[P];
+        for (size_t k = 0; k < K; ++k) {
+            for (size_t p = 0; p < P; ++p)
+                O[p * Kp + k] = T(c[p]);
+            for (size_t j = 0; j < P; ++j) { // c = c A
+                cA[j] = 0;
+                for (size_t i = 0; i < P; ++i)
+                    cA[j] += c[i] * A[i][j];
+            }
+            std::copy(cA, cA + P, c);
+        }
+
+        // Impulse response h₀ = D, hₖ = C Aᵏ⁻¹ B, and the input matrix
+        // columns Aᴷ⁻¹⁻ʲ B.
+        double h[K], v[P], Av[P];
+        std::copy(B, B + P, v);
+        h[0] = b[0];
+        for (size_t k = 0; k < K; ++k) {
+            for (size_t p = 0; p < P; ++p)
+                R[p * K + K - 1 - k] = T(v[p]);
+            if (k + 1 < K)
+                h[k + 1] = v[0];
+            mul(v, Av);
+            std::copy(Av, Av + P, v);
+        }
+        // Lower triangular Toeplitz matrix of the impulse response, stored
+        // column-major.
+        for (size_t j = 0; j < K; ++j)
+            for (size_t i = j; i < K; ++i)
+                H[j * Kp + i] = T(h[i - j]);
+
+        // State transition over a full block: Aᴷ.
+        for (size_t q = 0; q < P; ++q) {
+            double e[P] = {};
+            e[q] = 1;
+            for (size_t k = 0; k < K; ++k) {
+                mul(e, Av);
+                std::copy(Av, Av + P, e);
+            }
+            for (size_t p = 0; p < P; ++p)
+                AK[p * P + q] = T(e[p]);
+        }
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        T output = b0 * input + s[0];
+        for (size_t i = 0; i + 1 < P; ++i)
+            s[i] = b[i] * input + a[i] * output + s[i + 1];
+        s[P - 1] = b[P - 1] * input + a[P - 1] * output;
+        return output;
+    }
+
+    /**
+     * @brief   Filter a block of @p n inputs at once.
+     *
+     * Equivalent to calling @ref operator()() for each of the inputs (up to
+     * rounding errors), but computes @p K outputs at a time. If @p n is not
+     * a multiple of @p K, the remaining samples are filtered one by one.
+     *
+     * @param   in
+     *          Pointer to the @p n inputs.
+     * @param   out
+     *          Pointer to where the @p n outputs should be stored. May be equal
+     *          to @p in.
+     * @param   n
+     *          The number of samples to filter.
+     */
+    void process(const T *in, T *out, size_t n) {
+        for (; n >= K; n -= K, in += K, out += K)
+            processBlock(in, out);
+        for (size_t i = 0; i < n; ++i)
+            out[i] = (*this)(in[i]);
+    }
+
+  private:
+    void processBlock(const T *in, T *out) {
+        T u[K], y[Kp];
+        std::copy(in, in + K, u);
+        // Outputs: y = O s + H u
+        const T *O = this->O.begin(), *H = this->H.begin();
+        for (size_t i = 0; i < Kp; i += lanes) {
+            Pack acc = Pack::zero();
+            for (size_t p = 0; p < P; ++p)
+                acc += Pack::load(O + p * Kp + i) * Pack::broadcast(s[p]);
+            // H is lower triangular, columns j > i + lanes - 1 are zero.
+            const size_t last = std::min(i + lanes, K);
+            for (size_t j = 0; j < last; ++j)
+                acc += Pack::load(H + j * Kp + i) * Pack::broadcast(u[j]);
+            acc.store(y + i);
+        }
+        // Next state: s = Aᴷ s + R u
+        T s_next[P];
+        const T *AK = this->AK.begin(), *R = this->R.begin();
+        for (size_t p = 0; p < P; ++p) {
+            T acc = {};
+            for (size_t q = 0; q < P; ++q)
+                acc += AK[p * P + q] * s[q];
+            for (size_t j = 0; j < K; ++j)
+                acc += R[p * K + j] * u[j];
+            s_next[p] = acc;
+        }
+        std::copy(s_next, s_next + P, s.begin());
+        std::copy(y, y + K, out);
+    }
+
+  private:
+    constexpr static size_t lanes = Pack::lanes;
+    /// The block size rounded up to a multiple of the number of lanes.
+    constexpr static size_t Kp = (K + lanes - 1) / lanes * lanes;
+
+    AH::Array<T, P> s = {{}}; ///< Transposed Direct Form 2 state
+    AH::Array<T, P> b;        ///< Normalized numerator coefficients b₁…
+    AH::Array<T, P> a;        ///< Normalized, negated denominator a₁…
+    T b0;                     ///< Normalized numerator coefficient b₀
+    AH::Array<T, P * Kp> O = {{}}; ///< Observability matrix (column-major)
+    AH::Array<T, K * Kp> H = {{}}; ///< Impulse response matrix (column-major)
+    AH::Array<T, P * P> AK;        ///< Block state transition (row-major)
+    AH::Array<T, P * K> R;         ///< Block input matrix (row-major)
+};
+
+/// @}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <AH/STL/cmath>
+#include <Filters/AnalogPrototype.hpp>
+#include <Filters/ConstexprMath.hpp>
 #include <Filters/SOSFilter.hpp>
 
 /// @addtogroup FilterDesign
@@ -20,68 +22,57 @@
  * @tparam  T
  *          The type of the coefficients.
  * 
+ * The design only uses constexpr functions (see @ref constexpr_sincos), so
+ * the coefficients of a fixed design can be computed at compile time, without
+ * any startup cost or dependency on the math library:
+ * 
+ * ~~~cpp
+ * constexpr auto coefficients = butter_coeff<6>(0.1);
+ * auto filter = SOSFilter<float, 3>(coefficients);
+ * ~~~
+ * 
+ * This requires C++14. In C++11, which is the default of many Arduino cores
+ * (including AVR), this function is not constexpr: the example above doesn't
+ * compile, and the coefficients are computed at run time using `std::tan` and
+ * `std::cos` from the math library. Compile with `-std=gnu++14` to get
+ * compile-time designs on these boards.
+ * 
  * @see <https://tttapa.github.io/Pages/Mathematics/Systems-and-Control-Theory/Digital-filters/Discretization/Discretization-of-a-fourth-order-Butterworth-filter.html#discretization-using-second-order-sections-sos>
  */
 template <uint8_t N, class T = float>
-SOSCoefficients<T, (N + 1) / 2> butter_coeff(double f_n,
-                                             bool normalize = true) {
-    const double gamma = 1 / std::tan(M_PI * f_n / 2); // pre-warp factor
+FILTERS_CONSTEXPR14 SOSCoefficients<T, (N + 1) / 2>
+butter_coeff(double f_n, bool normalize = true) {
+    const double gamma = 1 / constexpr_tan(M_PI * f_n / 2); // pre-warp factor
+    const double gamma2 = gamma * gamma;
 
-    auto make_sos = [=](uint8_t k) {
-        const double gamma2 = gamma * gamma;
-        const double alpha = 2 * std::cos(2 * M_PI * (2 * k + N + 1) / (4 * N));
-        return BiQuadCoefficients<T>{
-            {{T(1.), T(2.), T(1.)}}, // b0, b1, b2
-            {{
-                T(gamma2 - alpha * gamma + 1), // a0
-                T(2 * (1 - gamma2)),           // a1
-                T(gamma2 + alpha * gamma + 1), // a2
-            }},
-        };
-    };
-    auto make_fos = [=]() {
-        return BiQuadCoefficients<T>{
-            {{T(1.), T(1.)}}, // b0, b1
-            {{
-                T(gamma + 1), // a0
-                T(1 - gamma), // a1
-            }},
-        };
-    };
-
-    auto make_sos_norm = [=](uint8_t k) {
-        const double gamma2 = gamma * gamma;
-        const double alpha = 2 * std::cos(2 * M_PI * (2 * k + N + 1) / (4 * N));
+    SOSCoefficients<T, (N + 1) / 2> sections = {{}};
+    // Second order sections
+    for (uint8_t k = 0; k < N / 2; ++k) {
+        const double alpha =
+            2 * constexpr_cos(2 * M_PI * (2 * k + N + 1) / (4 * N));
         const double a0 = gamma2 - alpha * gamma + 1;
-        return BiQuadCoefficients<T>{
-            {{T(1. / a0), T(2. / a0), T(1. / a0)}}, // b0, b1, b2
+        const double d = normalize ? a0 : 1;
+        sections.data[k] = BiQuadCoefficients<T>{
+            {{T(1. / d), T(2. / d), T(1. / d)}}, // b0, b1, b2
             {{
-                T(1.),                                // a0
-                T(2 * (1 - gamma2) / a0),             // a1
-                T((gamma2 + alpha * gamma + 1) / a0), // a2
+                T(a0 / d),                           // a0
+                T(2 * (1 - gamma2) / d),             // a1
+                T((gamma2 + alpha * gamma + 1) / d), // a2
             }},
         };
-    };
-    auto make_fos_norm = [=]() {
+    }
+    // First order section
+    if (N % 2 == 1) {
         const double a0 = gamma + 1;
-        return BiQuadCoefficients<T>{
-            {{T(1. / a0), T(1. / a0)}}, // b0, b1
+        const double d = normalize ? a0 : 1;
+        sections.data[N / 2] = BiQuadCoefficients<T>{
+            {{T(1. / d), T(1. / d), T(0.)}}, // b0, b1
             {{
-                T(1.),               // a0
-                T((1 - gamma) / a0), // a1
+                T(a0 / d),          // a0
+                T((1 - gamma) / d), // a1
+                T(0.),
             }},
         };
-    };
-
-    SOSCoefficients<T, (N + 1) / 2> sections;
-
-    if (N % 2 == 0) {
-        for (uint8_t i = 0; i < sections.length; ++i)
-            sections[i] = normalize ? make_sos_norm(i) : make_sos(i);
-    } else {
-        for (uint8_t i = 0; i < sections.length - 1; ++i)
-            sections[i] = normalize ? make_sos_norm(i) : make_sos(i);
-        sections.end()[-1] = normalize ? make_fos_norm() : make_fos();
     }
     return sections;
 }
@@ -111,4 +102,125 @@ SOSFilter<T, (N + 1) / 2, Implementation> butter(double f_n,
     return butter_coeff<N, T>(f_n, normalize);
 }
 
+/**
+ * @brief   Analog Butterworth low-pass prototype of order @p N.
+ *
+ * The poles are equally spaced on the left half of the unit circle, all zeros
+ * are at infinity.
+ */
+template <uint8_t N>
+AnalogPrototype<N> butter_prototype() {
+    static_assert(N > 0, "Order should be at least one");
+    AnalogPrototype<N> proto;
+    // p = -sin(θ) + j cos(θ), θ = π (2k + 1) / (2N)
+    for (uint8_t k = 0; k < N / 2; ++k) {
+        const double theta = M_PI * (2 * k + 1) / (2 * N);
+        proto.poles[k] = {-std::sin(theta), std::cos(theta)};
+    }
+    if (N % 2 == 1)
+        proto.poles[N / 2] = -1;
+    return proto;
+}
+
+/**
+ * @brief   Compute the coefficients of a Butterworth high-pass filter.
+ *
+ * The sections are paired, ordered and scaled as described in
+ * @ref analog_prototype2sos_highpass, the gain at the Nyquist frequency is
+ * one.
+ *
+ * @tparam  N
+ *          Order of the filter.
+ * @tparam  T
+ *          The type of the coefficients.
+ * @param   f_n
+ *          Normalized cut-off frequency in half-cycles per sample,
+ *          @f$ f_n = \frac{2 f_c}{f_s} \in \left[0, 1\right] @f$.
+ */
+template <uint8_t N, class T = float>
+SOSCoefficients<T, (N + 1) / 2> butter_highpass_coeff(double f_n) {
+    return analog_prototype2sos_highpass<T>(butter_prototype<N>(), f_n);
+}
+
+/**
+ * @brief   Compute the coefficients of a Butterworth band-pass filter.
+ *
+ * The low-pass prototype of order @p N is transformed into a band-pass filter
+ * of order @f$ 2N @f$ directly, which needs only @p N second order sections.
+ * The sections are paired, ordered and scaled as described in
+ * @ref analog_prototype2sos_bandpass, the gain at the center frequency of the
+ * pass band is one.
+ *
+ * The result is equivalent to SciPy's
+ * `butter(N, [f_low, f_high], 'bandpass', output='sos')`.
+ *
+ * @tparam  N
+ *          Order of the low-pass prototype, half of the order of the filter.
+ * @tparam  T
+ *          The type of the coefficients.
+ * @param   f_low
+ *          Normalized lower cut-off frequency in half-cycles per sample.
+ * @param   f_high
+ *          Normalized upper cut-off frequency in half-cycles per sample.
+ */
+template <uint8_t N, class T = float>
+SOSCoefficients<T, N> butter_bandpass_coeff(double f_low, double f_high) {
+    return analog_prototype2sos_bandpass<T>(butter_prototype<N>(), f_low,
+                                            f_high);
+}
+
+/**
+ * @brief   Compute the coefficients of a Butterworth band-stop filter.
+ *
+ * The sections are paired, ordered and scaled as described in
+ * @ref analog_prototype2sos_bandstop, the gain at DC is one.
+ *
+ * @tparam  N
+ *          Order of the low-pass prototype, half of the order of the filter.
+ * @tparam  T
+ *          The type of the coefficients.
+ * @param   f_low
+ *          Normalized lower edge of the stop band in half-cycles per sample.
+ * @param   f_high
+ *          Normalized upper edge of the stop band in half-cycles per sample.
+ */
+template <uint8_t N, class T = float>
+SOSCoefficients<T, N> butter_bandstop_coeff(double f_low, double f_high) {
+    return analog_prototype2sos_bandstop<T>(butter_prototype<N>(), f_low,
+                                            f_high);
+}
+
+/**
+ * @brief   Create a Butterworth high-pass filter, implemented as Second Order
+ *          Sections (SOS) filter.
+ *
+ * @see     @ref butter_highpass_coeff
+ */
+template <uint8_t N, class T = float, class Implementation = BiQuadFilterDF1<T>>
+SOSFilter<T, (N + 1) / 2, Implementation> butter_highpass(double f_n) {
+    return butter_highpass_coeff<N, T>(f_n);
+}
+
+/**
+ * @brief   Create a Butterworth band-pass filter, implemented as Second Order
+ *          Sections (SOS) filter.
+ *
+ * @see     @ref butter_bandpass_coeff
+ */
+template <uint8_t N, class T = float, class Implementation = BiQuadFilterDF1<T>>
+SOSFilter<T, N, Implementation> butter_bandpass(double f_low, double f_high) {
+    return butter_bandpass_coeff<N, T>(f_low, f_high);
+}
+
+/**
+ * @brief   Create a Butterworth band-stop filter, implemented as Second Order
+ *          Sections (SOS) filter.
+ *
+ * @see     @ref butter_bandstop_coeff
+ */
+template <uint8_t N, class T = float, class Implementation = BiQuadFilterDF1<T>>
+SOSFilter<T, N, Implementation> butter_bandstop(double f_low, double f_high) {
+    return butter_bandstop_coeff<N, T>(f_low, f_high);
+}
+
 /// @}
\ No newline at end of file
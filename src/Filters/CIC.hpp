@@ -0,0 +1,399 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/cmath>
+#include <AH/STL/cstdint>
+#include <AH/STL/limits>
+#include <AH/STL/type_traits>
+
+/// @cond HIDDEN_SYMBOLS
+
+/// Compute @f$ b^e @f$ at compile time.
+constexpr uintmax_t cic_power(uintmax_t b, uint8_t e) {
+    return e == 0 ? 1 : b * cic_power(b, e - 1);
+}
+
+/// Common types and functions of @ref CICDecimator and @ref CICInterpolator.
+template <class input_t, class state_t, uintmax_t Gain>
+struct CICBase {
+    static_assert(std::is_unsigned<state_t>::value,
+                  "state type should be unsigned");
+    static_assert(std::numeric_limits<state_t>::max() >=
+                      std::numeric_limits<input_t>::max(),
+                  "state type cannot be narrower than input type");
+
+    /// The type of the raw output, the input multiplied by the gain.
+    using raw_t = typename std::conditional<
+        std::is_signed<input_t>::value,
+        typename std::make_signed<state_t>::type, state_t>::type;
+
+    constexpr static state_t max_state = std::numeric_limits<state_t>::max();
+    constexpr static uintmax_t max_raw = std::numeric_limits<raw_t>::max();
+
+    static_assert(Gain <= max_raw, "state type too narrow for this gain");
+
+    /// Divide the raw output by the gain, rounding to nearest (ties away from
+    /// zero).
+    static input_t normalize(raw_t raw) {
+        constexpr raw_t gain = raw_t(Gain);
+        raw_t quotient = raw / gain;
+        const raw_t remainder = raw % gain;
+        const state_t abs_rem = remainder < 0 ? state_t(0) - state_t(remainder)
+                                              : state_t(remainder);
+        if (abs_rem >= state_t(gain) - abs_rem)
+            quotient += remainder < 0 ? -1 : 1;
+        return input_t(quotient);
+    }
+
+    /// @copydoc CICDecimator::supports_range
+    template <class T>
+    constexpr static bool supports_range(T min, T max) {
+        return min <= max && min >= std::numeric_limits<input_t>::min() &&
+               max <= std::numeric_limits<input_t>::max() &&
+               (max <= 0 || uintmax_t(max) <= max_raw / Gain) &&
+               (min >= 0 || uintmax_t(-(min + 1)) < (max_raw + 1) / Gain);
+    }
+};
+
+/// @endcond
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Cascaded Integrator-Comb (CIC) decimation filter.
+ *
+ * Filters the input with a cascade of @p Stages moving sums of length
+ * @f$ RM @f$ and keeps every @p R -th output:
+ *
+ * @f[
+ * H(z) = \left( \sum_{k=0}^{RM-1} z^{-k} \right)^{S}
+ *      = \left( \frac{1 - z^{-RM}}{1 - z^{-1}} \right)^{S}
+ * @f]
+ *
+ * The @p Stages integrators run at the input rate, the @p Stages combs run at
+ * the output rate, after decimation. This requires only additions and
+ * subtractions, @p Stages per input and @p Stages per output, and
+ * @f$ S (M + 1) @f$ words of memory, independent of the decimation factor.
+ * This makes it ideal for decimating heavily oversampled ADC data, e.g.
+ * followed by an @ref FIRFilter with coefficients from
+ * @ref cic_compensator_coeff to flatten the pass band.
+ *
+ * The integrators overflow all the time, this is harmless: all arithmetic is
+ * carried out using unsigned integers, modulo @f$ 2^{\text{bits}} @f$ (the
+ * same trick as the @ref EMA class), and the final output is correct as long
+ * as it fits in the state type. Use @ref supports_range to check this.
+ *
+ * Use @ref update() with each new input, it returns true when a new output
+ * is available, which can then be retrieved using @ref getValue() (scaled to
+ * the input range) or @ref getRawValue() (full precision).
+ *
+ * @tparam  R
+ *          The decimation factor.
+ * @tparam  M
+ *          The differential delay of the combs (usually one or two).
+ * @tparam  Stages
+ *          The number of integrator and comb stages @f$ S @f$.
+ * @tparam  input_t
+ *          The integer type of the input (and of the scaled output). Can be
+ *          signed or unsigned.
+ * @tparam  state_t
+ *          The unsigned integer type of the integrators and the combs, it
+ *          should have at least @f$ B + \lceil S \log_2(RM) \rceil @f$ bits,
+ *          where @f$ B @f$ is the number of bits of the input.
+ */
+template <uint16_t R, uint8_t M = 1, uint8_t Stages = 3,
+          class input_t = int16_t, class state_t = uint32_t>
+class CICDecimator {
+    static_assert(R > 0 && M > 0 && Stages > 0, "");
+
+  public:
+    /// The DC gain @f$ (RM)^S @f$ of the filter.
+    constexpr static uintmax_t gain = cic_power(uintmax_t(R) * M, Stages);
+
+  private:
+    using Base = CICBase<input_t, state_t, gain>;
+
+  public:
+    /// The type of the raw output: signed if the input is signed.
+    using raw_t = typename Base::raw_t;
+
+    /**
+     * @brief   Update the internal state with a new input.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$.
+     * @retval  true
+     *          A new output is available, and can be retrieved using
+     *          @ref getValue() or @ref getRawValue(). This is the case for
+     *          every @p R -th input.
+     * @retval  false
+     *          No new output yet.
+     */
+    bool update(input_t input) {
+        state_t x = state_t(input);
+        for (auto &integrator : integrators)
+            x = integrator += x;
+        if (++phase < R)
+            return false;
+        phase = 0;
+        for (auto &comb : combs) {
+            const state_t delayed = comb[index];
+            comb[index] = x;
+            x -= delayed;
+        }
+        if (++index == M)
+            index = 0;
+        output = x;
+        return true;
+    }
+
+    /// Get the most recent output, divided by the @ref gain and rounded, so
+    /// it has the same scale as the input.
+    input_t getValue() const { return Base::normalize(getRawValue()); }
+
+    /// Get the most recent output at full precision, @ref gain times larger
+    /// than the input.
+    raw_t getRawValue() const { return raw_t(output); }
+
+    /**
+     * @brief   Update the internal state with @p R new inputs and return the
+     *          new output.
+     *
+     * @param   inputs
+     *          Pointer to @p R consecutive inputs.
+     * @return  The new output, scaled like @ref getValue(). Only includes all
+     *          of the @p R inputs if the decimator was at the start of a block,
+     *          i.e. if it was only updated in blocks of @p R inputs so far.
+     */
+    input_t operator()(const input_t *inputs) {
+        for (uint16_t i = 0; i < R; ++i)
+            update(inputs[i]);
+        return getValue();
+    }
+
+    /**
+     * @brief   Check whether all inputs between @p min and @p max result in
+     *          outputs that fit in the state type.
+     *
+     * ~~~cpp
+     * using Decimator = CICDecimator<16, 1, 3, int16_t, uint32_t>;
+     * static_assert(Decimator::supports_range(-2048, 2047),
+     *               "use a wider state type or a smaller decimation factor");
+     * ~~~
+     */
+    template <class T>
+    constexpr static bool supports_range(T min, T max) {
+        return Base::supports_range(min, max);
+    }
+
+  private:
+    uint16_t phase = 0;
+    uint8_t index = 0;
+    state_t output = 0;
+    AH::Array<state_t, Stages> integrators = {{}};
+    AH::Array<AH::Array<state_t, M>, Stages> combs = {{}};
+};
+
+/**
+ * @brief   Cascaded Integrator-Comb (CIC) interpolation filter.
+ *
+ * Upsamples the input by a factor @p R by inserting @f$ R - 1 @f$ zeros
+ * after every sample, and filters the result with the same transfer function
+ * as the @ref CICDecimator. The combs run at the input rate, the integrators
+ * at the output rate. This results in a piecewise polynomial interpolation of
+ * the input (sample and hold for one stage, linear interpolation for two).
+ *
+ * The DC gain of the filter is @f$ R^{S-1} M^S @f$ (zero-stuffing divides the
+ * level of the signal by @p R), the normalized outputs are divided by this
+ * gain, so they have the same scale as the input. The state type should be
+ * wide enough to hold the input multiplied by this gain, the same modulo
+ * arithmetic as the decimator makes sure that overflow of the intermediate
+ * results is harmless.
+ *
+ * @tparam  R
+ *          The interpolation factor.
+ * @tparam  M
+ *          The differential delay of the combs (usually one).
+ * @tparam  Stages
+ *          The number of comb and integrator stages @f$ S @f$.
+ * @tparam  input_t
+ *          The integer type of the input (and of the scaled outputs). Can be
+ *          signed or unsigned.
+ * @tparam  state_t
+ *          The unsigned integer type of the combs and the integrators.
+ */
+template <uint16_t R, uint8_t M = 1, uint8_t Stages = 3,
+          class input_t = int16_t, class state_t = uint32_t>
+class CICInterpolator {
+    static_assert(R > 0 && M > 0 && Stages > 0, "");
+
+  public:
+    /// The DC gain @f$ R^{S-1} M^S @f$ of the filter.
+    constexpr static uintmax_t gain =
+        cic_power(R, Stages - 1) * cic_power(M, Stages);
+
+  private:
+    using Base = CICBase<input_t, state_t, gain>;
+
+  public:
+    /// The type of the raw outputs: signed if the input is signed.
+    using raw_t = typename Base::raw_t;
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[m] @f$ and
+     *          write the @p R new outputs at full precision (@ref gain times
+     *          larger than the input) to the given buffer.
+     *
+     * @param   input
+     *          The new input @f$ x[m] @f$.
+     * @param   outputs
+     *          Pointer to where the @p R new outputs should be stored.
+     */
+    void updateRaw(input_t input, raw_t *outputs) {
+        state_t x = state_t(input);
+        for (auto &comb : combs) {
+            const state_t delayed = comb[index];
+            comb[index] = x;
+            x -= delayed;
+        }
+        if (++index == M)
+            index = 0;
+        for (uint16_t r = 0; r < R; ++r) {
+            state_t y = r == 0 ? x : state_t(0);
+            for (auto &integrator : integrators)
+                y = integrator += y;
+            outputs[r] = raw_t(y);
+        }
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[m] @f$ and
+     *          write the @p R new outputs, with the same scale as the input,
+     *          to the given buffer.
+     *
+     * @param   input
+     *          The new input @f$ x[m] @f$.
+     * @param   outputs
+     *          Pointer to where the @p R new outputs should be stored.
+     */
+    void operator()(input_t input, input_t *outputs) {
+        raw_t raw[R];
+        updateRaw(input, raw);
+        for (uint16_t r = 0; r < R; ++r)
+            outputs[r] = Base::normalize(raw[r]);
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[m] @f$ and
+     *          return the @p R new outputs, with the same scale as the input.
+     *
+     * @param   input
+     *          The new input @f$ x[m] @f$.
+     * @return  The @p R new outputs, oldest first.
+     */
+    AH::Array<input_t, R> operator()(input_t input) {
+        AH::Array<input_t, R> outputs;
+        (*this)(input, outputs.begin());
+        return outputs;
+    }
+
+    /// @copydoc CICDecimator::supports_range
+    template <class T>
+    constexpr static bool supports_range(T min, T max) {
+        return Base::supports_range(min, max);
+    }
+
+  private:
+    uint8_t index = 0;
+    AH::Array<AH::Array<state_t, M>, Stages> combs = {{}};
+    AH::Array<state_t, Stages> integrators = {{}};
+};
+
+/// @}
+
+/// @addtogroup FilterDesign
+/// @{
+
+/**
+ * @brief   Normalized magnitude response of a CIC filter (@ref CICDecimator
+ *          or @ref CICInterpolator), at the low sample rate.
+ *
+ * @f[
+ * \left| H(\omega) \right| = \left| \frac{\sin(\omega M / 2)}
+ *                                        {R M \sin(\omega / (2R))} \right|^S
+ * @f]
+ *
+ * @param   f_n
+ *          Normalized frequency in half-cycles per sample at the low rate,
+ *          @f$ \omega = \pi f_n @f$.
+ */
+inline double cic_magnitude(uint16_t R, uint8_t M, uint8_t Stages,
+                            double f_n) {
+    const double w = M_PI * f_n;
+    if (w == 0)
+        return 1;
+    const double h = std::sin(w * M / 2) / (R * M * std::sin(w / (2 * R)));
+    return std::pow(std::abs(h), Stages);
+}
+
+/**
+ * @brief   Design a linear phase FIR filter that compensates the pass band
+ *          droop of a CIC filter.
+ *
+ * The magnitude response of a CIC filter falls off like a power of a sinc
+ * function, so even well within the pass band, the signal is attenuated. A
+ * short FIR filter at the low sample rate (after a @ref CICDecimator, or
+ * before a @ref CICInterpolator) with the inverse response in the pass band
+ * makes the combined response flat.
+ *
+ * The coefficients are designed using the window method: the desired
+ * response, @f$ 1 / |H(\omega)| @f$ (see @ref cic_magnitude) up to @p f_n
+ * and zero above, is sampled on a dense frequency grid, transformed to the
+ * time domain and multiplied by a Hamming window. The result is scaled to
+ * unity gain at DC. Since the stop band of the compensator also attenuates
+ * the aliases of the CIC filter, @p f_n is usually chosen between 0.5 and
+ * 0.8.
+ *
+ * @tparam  N
+ *          The number of coefficients, should be odd for a symmetric filter
+ *          with an integer delay.
+ * @tparam  T
+ *          The type of the coefficients.
+ * @param   R
+ *          The decimation (or interpolation) factor of the CIC filter.
+ * @param   M
+ *          The differential delay of the CIC filter.
+ * @param   Stages
+ *          The number of stages of the CIC filter.
+ * @param   f_n
+ *          Normalized cut-off frequency in half-cycles per sample at the low
+ *          sample rate.
+ */
+template <uint8_t N, class T = float>
+AH::Array<T, N> cic_compensator_coeff(uint16_t R, uint8_t M, uint8_t Stages,
+                                      double f_n) {
+    constexpr uint16_t grid = 512; // frequency samples in [0, π]
+    const double center = (N - 1) / 2.;
+    double h[N] = {}, sum = 0;
+    for (uint16_t k = 0; k < grid; ++k) {
+        const double f = (k + 0.5) / grid;
+        if (f > f_n)
+            break;
+        const double d = 1 / cic_magnitude(R, M, Stages, f);
+        for (uint8_t n = 0; n < N; ++n)
+            h[n] += d * std::cos(M_PI * f * (n - center));
+    }
+    for (uint8_t n = 0; n < N; ++n) {
+        const double w =
+            N > 1 ? 0.54 - 0.46 * std::cos(2 * M_PI * n / (N - 1)) : 1;
+        h[n] *= w;
+        sum += h[n];
+    }
+    AH::Array<T, N> coefficients;
+    for (uint8_t n = 0; n < N; ++n)
+        coefficients[n] = T(h[n] / sum);
+    return coefficients;
+}
+
+/// @}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <AH/STL/cmath>
+#include <Filters/AnalogPrototype.hpp>
+#include <Filters/SOSFilter.hpp>
+
+/// @addtogroup FilterDesign
+/// @{
+
+/**
+ * @brief   Analog Chebyshev type I low-pass prototype of order @p N with a
+ *          pass band ripple of @p r_pass decibels.
+ *
+ * Use it with @ref analog_prototype2sos_highpass,
+ * @ref analog_prototype2sos_bandpass or @ref analog_prototype2sos_bandstop to
+ * design other filter types.
+ *
+ * @see     @ref cheby1_coeff
+ */
+template <uint8_t N>
+AnalogPrototype<N> cheby1_prototype(double r_pass) {
+    static_assert(N > 0, "Order should be at least one");
+    const double eps = std::sqrt(std::pow(10., r_pass / 10) - 1);
+    const double mu = std::asinh(1 / eps) / N;
+
+    // Poles on an ellipse in the left half plane:
+    // p = -sinh(μ + jθ), θ = π m / (2N), m = N - 1, N - 3, ..., > -1
+    AnalogPrototype<N> proto;
+    for (uint8_t k = 0; k < (N + 1) / 2; ++k) {
+        const double theta = M_PI * (N - 1 - 2 * k) / (2 * N);
+        proto.poles[k] = {-std::sinh(mu) * std::cos(theta),
+                          -std::cosh(mu) * std::sin(theta)};
+    }
+    // Even order filters start at the bottom of the ripple.
+    proto.dc_gain = N % 2 ? 1 : 1 / std::sqrt(1 + eps * eps);
+    return proto;
+}
+
+/**
+ * @brief   Compute Chebyshev type I filter coefficients.
+ *
+ * Chebyshev type I filters have an equiripple pass band with a maximum
+ * ripple of @p r_pass decibels, and a monotonic stop band. They have a
+ * steeper transition than Butterworth filters of the same order. Use
+ * @ref cheby1_order to find the lowest order that meets a given
+ * specification.
+ *
+ * The result is equivalent to SciPy's `cheby1(N, r_pass, f_n, output='sos')`,
+ * see @ref analog_prototype2sos for the order of the sections and the
+ * distribution of the gain.
+ *
+ * @tparam  N
+ *          Order of the filter.
+ * @tparam  T
+ *          The type of the coefficients.
+ * @param   f_n
+ *          Normalized cut-off frequency in half-cycles per sample, the
+ *          frequency where the gain drops below @f$ -r_{pass} @f$ dB for the
+ *          last time. @f$ f_n = \frac{2 f_c}{f_s} \in \left[0, 1\right] @f$,
+ *          where @f$ f_s @f$ is the sample frequency in @f$ \text{Hz} @f$,
+ *          and @f$ f_c @f$ is the cut-off frequency in @f$ \text{Hz} @f$.
+ * @param   r_pass
+ *          The maximum ripple in the pass band, in decibels.
+ */
+template <uint8_t N, class T = float>
+SOSCoefficients<T, (N + 1) / 2> cheby1_coeff(double f_n, double r_pass) {
+    return analog_prototype2sos<T>(cheby1_prototype<N>(r_pass), f_n);
+}
+
+/**
+ * @brief   Analog Chebyshev type II low-pass prototype of order @p N with a
+ *          stop band attenuation of @p r_stop decibels, and a stop band edge
+ *          at @f$ 1\ \mathrm{rad/s} @f$.
+ *
+ * @see     @ref cheby1_prototype, @ref cheby2_coeff
+ */
+template <uint8_t N>
+AnalogPrototype<N> cheby2_prototype(double r_stop) {
+    static_assert(N > 0, "Order should be at least one");
+    const double eps = 1 / std::sqrt(std::pow(10., r_stop / 10) - 1);
+    const double mu = std::asinh(1 / eps) / N;
+
+    // Inverted Chebyshev type I poles: p = -1 / sinh(μ + jθ),
+    // zeros: ±j / sin(θ), θ = π m / (2N), m = N - 1, N - 3, ..., > 0
+    AnalogPrototype<N> proto;
+    for (uint8_t k = 0; k < (N + 1) / 2; ++k) {
+        const double theta = M_PI * (N - 1 - 2 * k) / (2 * N);
+        const std::complex<double> s = {std::sinh(mu) * std::cos(theta),
+                                        std::cosh(mu) * std::sin(theta)};
+        proto.poles[k] = -1. / s;
+        if (N - 1 - 2 * k > 0)
+            proto.zeros[proto.num_zeros++] = 1 / std::sin(theta);
+    }
+    return proto;
+}
+
+/**
+ * @brief   Compute Chebyshev type II (inverse Chebyshev) filter
+ *          coefficients.
+ *
+ * Chebyshev type II filters have a monotonic pass band, and an equiripple
+ * stop band with an attenuation of at least @p r_stop decibels. Use
+ * @ref cheby2_order to find the lowest order that meets a given
+ * specification.
+ *
+ * The result is equivalent to SciPy's `cheby2(N, r_stop, f_n, output='sos')`,
+ * see @ref analog_prototype2sos for the order of the sections and the
+ * distribution of the gain.
+ *
+ * @tparam  N
+ *          Order of the filter.
+ * @tparam  T
+ *          The type of the coefficients.
+ * @param   f_n
+ *          Normalized stop band edge frequency in half-cycles per sample,
+ *          the frequency where the attenuation first reaches @p r_stop.
+ * @param   r_stop
+ *          The minimum attenuation in the stop band, in decibels.
+ */
+template <uint8_t N, class T = float>
+SOSCoefficients<T, (N + 1) / 2> cheby2_coeff(double f_n, double r_stop) {
+    return analog_prototype2sos<T>(cheby2_prototype<N>(r_stop), f_n);
+}
+
+/**
+ * @brief   Create a Chebyshev type I filter, implemented as Second Order
+ *          Sections (SOS) filter.
+ *
+ * @see     @ref cheby1_coeff
+ */
+template <uint8_t N, class T = float, class Implementation = BiQuadFilterDF1<T>>
+SOSFilter<T, (N + 1) / 2, Implementation> cheby1(double f_n, double r_pass) {
+    return cheby1_coeff<N, T>(f_n, r_pass);
+}
+
+/**
+ * @brief   Create a Chebyshev type II filter, implemented as Second Order
+ *          Sections (SOS) filter.
+ *
+ * @see     @ref cheby2_coeff
+ */
+template <uint8_t N, class T = float, class Implementation = BiQuadFilterDF1<T>>
+SOSFilter<T, (N + 1) / 2, Implementation> cheby2(double f_n, double r_stop) {
+    return cheby2_coeff<N, T>(f_n, r_stop);
+}
+
+/// @}
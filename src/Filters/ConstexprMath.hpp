@@ -0,0 +1,240 @@
+#pragma once
+
+#include <AH/STL/cmath>
+#include <AH/STL/cstdint>
+#include <AH/STL/limits>
+
+/// @addtogroup FilterDesign
+/// @{
+
+/**
+ * @brief   `constexpr` for functions that need the relaxed rules of C++14
+ *          (loops, local variables, several statements).
+ *
+ * When compiling as C++11 (e.g. the default `-std=gnu++11` of many Arduino
+ * cores, including AVR), these functions are ordinary inline functions
+ * instead, and the elementary functions below simply call the standard
+ * library. Filter designs then run at startup and link in the math library.
+ * Compile with `-std=gnu++14` or later to evaluate them at compile time.
+ */
+#if __cplusplus >= 201402L || defined(DOXYGEN)
+#define FILTERS_CONSTEXPR14 constexpr
+#else
+#define FILTERS_CONSTEXPR14 inline
+#endif
+
+#if __cplusplus >= 201402L || defined(DOXYGEN)
+
+/**
+ * @brief   Sine and cosine of @p x, usable in constant expressions.
+ *
+ * The argument is reduced to @f$ r \in [-\pi/4, \pi/4] @f$ using
+ * @f$ x = r + k \pi/2 @f$, where @f$ \pi/2 @f$ is split into two parts to
+ * keep the reduction exact for moderate @f$ |x| @f$. Then both Taylor series
+ * are evaluated up to the last term that still affects a double precision
+ * result, and the quadrant @f$ k @f$ selects the sign and the function.
+ *
+ * The result is within a few ULP of `std::sin` and `std::cos` for
+ * @f$ |x| < 10^6 @f$, more than enough for filter design, where the arguments
+ * are at most a few times @f$ \pi @f$.
+ *
+ * @param   x
+ *          The angle in radians.
+ * @param   sin
+ *          Output: @f$ \sin(x) @f$.
+ * @param   cos
+ *          Output: @f$ \cos(x) @f$.
+ */
+constexpr void constexpr_sincos(double x, double &sin, double &cos) {
+    // π/2 = pio2_hi + pio2_lo, where pio2_hi has 33 significant bits, so that
+    // k · pio2_hi is exact for k < 2²⁰.
+    constexpr double pio2_hi = 1.57079632673412561417e+00;
+    constexpr double pio2_lo = 6.07710050650619224932e-11;
+    const double kf = x * (2 / M_PI);
+    const long k = long(kf < 0 ? kf - 0.5 : kf + 0.5);
+    const double r = (x - double(k) * pio2_hi) - double(k) * pio2_lo;
+    const double r2 = r * r;
+    // Taylor series, evaluated from the smallest term upwards.
+    double s = 0, c = 0;
+    for (uint8_t n = 12; n > 0; --n) {
+        s = 1 - s * r2 / double((2 * n) * (2 * n + 1));
+        c = 1 - c * r2 / double((2 * n - 1) * (2 * n));
+    }
+    s *= r;
+    switch (k & 3) {
+        case 0: sin = s, cos = c; break;
+        case 1: sin = c, cos = -s; break;
+        case 2: sin = -s, cos = -c; break;
+        default: sin = -c, cos = s; break;
+    }
+}
+
+/// Sine of @p x (in radians), usable in constant expressions.
+/// @see    @ref constexpr_sincos
+constexpr double constexpr_sin(double x) {
+    double s = 0, c = 0;
+    constexpr_sincos(x, s, c);
+    return s;
+}
+
+/// Cosine of @p x (in radians), usable in constant expressions.
+/// @see    @ref constexpr_sincos
+constexpr double constexpr_cos(double x) {
+    double s = 0, c = 0;
+    constexpr_sincos(x, s, c);
+    return c;
+}
+
+/// Tangent of @p x (in radians), usable in constant expressions.
+/// @see    @ref constexpr_sincos
+constexpr double constexpr_tan(double x) {
+    double s = 0, c = 0;
+    constexpr_sincos(x, s, c);
+    return s / c;
+}
+
+/// Square root of @p x, usable in constant expressions.
+/// Returns zero if @p x is negative.
+constexpr double constexpr_sqrt(double x) {
+    if (x != x || x == 0 || !(x < std::numeric_limits<double>::infinity()))
+        return x; // NaN, zero and infinity (the loops below would not end)
+    if (x < 0)
+        return 0;
+    // Scale by powers of four (exactly) to get x in [1/4, 4].
+    double scale = 1;
+    for (; x > 4; x /= 4)
+        scale *= 2;
+    for (; x < 0.25; x *= 4)
+        scale /= 2;
+    // Newton's method converges in a handful of steps starting from 1.
+    double y = 1;
+    for (uint8_t i = 0; i < 10; ++i)
+        y = (y + x / y) / 2;
+    return y * scale;
+}
+
+/// Natural exponential function of @p x, usable in constant expressions.
+constexpr double constexpr_exp(double x) {
+    if (x != x)
+        return x;
+    if (x > 710) // overflow (this also avoids an out-of-range k below)
+        return std::numeric_limits<double>::infinity();
+    if (x < -746) // underflow
+        return 0;
+    // x = k ln(2) + r, with |r| ≤ ln(2) / 2
+    long k = long(x * M_LOG2E + (x < 0 ? -0.5 : 0.5));
+    const double r = x - double(k) * M_LN2;
+    double e = 1;
+    for (uint8_t n = 20; n > 0; --n)
+        e = 1 + e * r / n;
+    for (; k > 0; --k)
+        e *= 2;
+    for (; k < 0; ++k)
+        e /= 2;
+    return e;
+}
+
+/// Natural logarithm of @p x, usable in constant expressions.
+/// Returns NaN if @p x is negative.
+constexpr double constexpr_log(double x) {
+    // The loops below would not end for zero or infinity.
+    if (x == 0)
+        return -std::numeric_limits<double>::infinity();
+    if (!(x >= 0)) // negative or NaN
+        return std::numeric_limits<double>::quiet_NaN();
+    if (!(x < std::numeric_limits<double>::infinity()))
+        return x;
+    // x = 2ᵉ m, with m in [√½, √2]
+    long e = 0;
+    for (; x > M_SQRT2; x /= 2)
+        ++e;
+    for (; x < M_SQRT1_2; x *= 2)
+        --e;
+    // log(m) = 2 atanh(t), with t = (m - 1) / (m + 1), |t| < 0.172
+    const double t = (x - 1) / (x + 1), t2 = t * t;
+    double s = 0;
+    for (uint8_t k = 12; k-- > 0;)
+        s = 1. / (2 * k + 1) + t2 * s;
+    return 2 * t * s + double(e) * M_LN2;
+}
+
+/// Arctangent of @p x (in radians), usable in constant expressions.
+constexpr double constexpr_atan(double x) {
+    if (x < 0)
+        return -constexpr_atan(-x);
+    if (x > 1)
+        return M_PI_2 - constexpr_atan(1 / x);
+    // atan(x) = π/6 + atan((√3 x - 1) / (√3 + x)), to get |x| < 2 - √3
+    double offset = 0;
+    constexpr double sqrt3 = 1.73205080756887729353;
+    if (x > 2 - sqrt3) {
+        x = (sqrt3 * x - 1) / (sqrt3 + x);
+        offset = M_PI / 6;
+    }
+    const double x2 = x * x;
+    double s = 0;
+    for (uint8_t k = 16; k-- > 0;)
+        s = (k % 2 ? -1. : 1.) / (2 * k + 1) + x2 * s;
+    return offset + x * s;
+}
+
+#else // C++11: no relaxed constexpr, use the standard library instead
+
+inline void constexpr_sincos(double x, double &sin, double &cos) {
+    sin = std::sin(x);
+    cos = std::cos(x);
+}
+inline double constexpr_sin(double x) { return std::sin(x); }
+inline double constexpr_cos(double x) { return std::cos(x); }
+inline double constexpr_tan(double x) { return std::tan(x); }
+inline double constexpr_sqrt(double x) { return x < 0 ? 0 : std::sqrt(x); }
+inline double constexpr_exp(double x) { return std::exp(x); }
+inline double constexpr_log(double x) { return std::log(x); }
+inline double constexpr_atan(double x) { return std::atan(x); }
+
+#endif
+
+/// Hyperbolic cosine of @p x, usable in constant expressions.
+FILTERS_CONSTEXPR14 double constexpr_cosh(double x) {
+    return (constexpr_exp(x) + constexpr_exp(-x)) / 2;
+}
+
+/// Inverse hyperbolic cosine of @p x ≥ 1, usable in constant expressions.
+FILTERS_CONSTEXPR14 double constexpr_acosh(double x) {
+    return constexpr_log(x + constexpr_sqrt((x - 1) * (x + 1)));
+}
+
+/// Arithmetic-geometric mean of @p a and @p b, usable in constant
+/// expressions.
+FILTERS_CONSTEXPR14 double constexpr_agm(double a, double b) {
+    for (uint8_t i = 0; i < 64 && a - b > 1e-16 * a; ++i) {
+        const double an = (a + b) / 2;
+        b = constexpr_sqrt(a * b);
+        a = an;
+    }
+    return (a + b) / 2;
+}
+
+/**
+ * @brief   Complete elliptic integral of the first kind, usable in constant
+ *          expressions.
+ *
+ * @f[
+ * K(m) = \int_0^{\pi/2} \frac{d\theta}{\sqrt{1 - m \sin^2 \theta}}
+ *      = \frac{\pi}{2 \operatorname{AGM}\left(1, \sqrt{1 - m}\right)}
+ * @f]
+ *
+ * @param   m
+ *          The parameter @f$ m = k^2 \in [0, 1) @f$.
+ */
+FILTERS_CONSTEXPR14 double constexpr_ellipk(double m) {
+    return M_PI_2 / constexpr_agm(1, constexpr_sqrt(1 - m));
+}
+
+/// Complete elliptic integral of the first kind of the complementary
+/// parameter, @f$ K(1 - p) @f$, accurate for small @p p.
+FILTERS_CONSTEXPR14 double constexpr_ellipkm1(double p) {
+    return M_PI_2 / constexpr_agm(1, constexpr_sqrt(p));
+}
+
+/// @}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <AH/STL/cstdint>     // uint8_t, uint16_t
+#include <AH/STL/type_traits> // std::conditional
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Median filter for unsigned integer inputs with a small number of
+ *          bits, e.g. ADC readings, with a cost per sample that doesn't
+ *          depend on the window length.
+ *
+ * Returns the same output as @ref MedianFilter<N, uint16_t>.
+ *
+ * Instead of sorting the window, the filter keeps a histogram of the inputs
+ * in the window, with one bin per possible input value, and the position of
+ * the median in that histogram. A new input changes the rank of the median
+ * by at most one, so the median only moves to the nearest non-empty bin
+ * above or below it. To skip long runs of empty bins quickly, the histogram
+ * has a second, coarse level, where each coarse bin counts the inputs in a
+ * block of @f$ 2^{\lceil Bits/2 \rceil} @f$ fine bins. Finding the next
+ * non-empty bin then takes at most about @f$ 2 \cdot 2^{Bits/2} @f$ steps
+ * (e.g. 64 for 10-bit inputs), but usually just a few, independent of @p N.
+ *
+ * The histogram uses @f$ 2^{Bits} @f$ counters of one byte (two bytes if
+ * @p N > 255), in addition to the ring buffer with the @p N inputs, e.g.
+ * 1 KiB for 10-bit inputs. This makes long windows affordable on small
+ * microcontrollers, as long as the resolution is limited.
+ *
+ * @tparam  N
+ *          The number of previous values to take the median of.
+ * @tparam  Bits
+ *          The number of bits of the inputs. Inputs greater than
+ *          @f$ 2^{Bits} - 1 @f$ are clamped to that value.
+ */
+template <uint16_t N, uint8_t Bits = 10>
+class CountingMedianFilter {
+    static_assert(N > 0, "Window length must be at least one");
+    static_assert(Bits > 0 && Bits <= 16, "Inputs must fit in 16 bits");
+
+  public:
+    /// The largest supported input value.
+    constexpr static uint16_t max_value = uint16_t((1ul << Bits) - 1);
+
+    /**
+     * @brief   Construct a new Counting Median Filter (zero initialized).
+     */
+    CountingMedianFilter() : CountingMedianFilter(0) {}
+
+    /**
+     * @brief   Construct a new Counting Median Filter, and initialize it with
+     *          the given value.
+     *
+     * @param   initialValue
+     *          Determines the initial state of the filter:
+     *          @f$ x[-N] =\ \ldots\ = x[-2] = x[-1] = \text{initialValue} @f$
+     */
+    CountingMedianFilter(uint16_t initialValue) {
+        if (initialValue > max_value)
+            initialValue = max_value;
+        for (uint16_t &x : previousInputs)
+            x = initialValue;
+        fine[initialValue] = N;
+        coarse[initialValue >> fine_bits] = N;
+        median = initialValue;
+    }
+
+    /**
+     * @brief   Calculate the output @f$ y[n] @f$ for a given input
+     *          @f$ x[n] @f$.
+     *
+     * @f$ y[n] = \text{median}\Big(x[n], x[n-1],\ \ldots,\ x[n-N+1]\Big) @f$
+     *
+     * @param   x
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    uint16_t operator()(uint16_t x) {
+        if (x > max_value)
+            x = max_value;
+        // Replace the oldest input in the histogram.
+        uint16_t old = previousInputs[index];
+        previousInputs[index] = x;
+        if (++index == N)
+            index = 0;
+        --fine[old];
+        --coarse[old >> fine_bits];
+        below -= old < median;
+        ++fine[x];
+        ++coarse[x >> fine_bits];
+        below += x < median;
+
+        // Move the median to the bin that contains the input with rank
+        // (N - 1) / 2 (the lower median), i.e. the bin with fewer than
+        // rank + 1 inputs below it, and at least rank + 1 inputs up to and
+        // including it.
+        constexpr count_t rank = (N - 1) / 2;
+        while (below > rank) {
+            median = previousNonEmpty(median);
+            below -= fine[median];
+        }
+        while (below + fine[median] <= rank) {
+            below += fine[median];
+            median = nextNonEmpty(median);
+        }
+
+        // If the length of the window is even, then we need to take the
+        // average of the inputs with ranks N / 2 - 1 and N / 2.
+        if (N % 2 == 0) {
+            uint16_t upper = below + fine[median] > rank + 1
+                                 ? median
+                                 : nextNonEmpty(median);
+            return (median + upper) / 2;
+        } else {
+            return median;
+        }
+    }
+
+  private:
+    /// The number of fine bins per coarse bin is 2^fine_bits.
+    constexpr static uint8_t fine_bits = (Bits + 1) / 2;
+    constexpr static uint16_t fine_mask = (1u << fine_bits) - 1;
+    constexpr static uint32_t num_fine = 1ul << Bits;
+    constexpr static uint32_t num_coarse = 1ul << (Bits - fine_bits);
+    using count_t = typename std::conditional<(N < 256), uint8_t, //
+                                              uint16_t>::type;
+
+    /// Find the smallest input in the window that is greater than @p x.
+    /// There must be one.
+    uint16_t nextNonEmpty(uint16_t x) const {
+        // Search the rest of the current block of fine bins.
+        while ((x & fine_mask) != fine_mask)
+            if (fine[++x])
+                return x;
+        // Find the next non-empty block, then search it.
+        uint16_t block = x >> fine_bits;
+        while (!coarse[++block])
+            ;
+        x = block << fine_bits;
+        while (!fine[x])
+            ++x;
+        return x;
+    }
+
+    /// Find the largest input in the window that is less than @p x.
+    /// There must be one.
+    uint16_t previousNonEmpty(uint16_t x) const {
+        while ((x & fine_mask) != 0)
+            if (fine[--x])
+                return x;
+        uint16_t block = x >> fine_bits;
+        while (!coarse[--block])
+            ;
+        x = (block << fine_bits) | fine_mask;
+        while (!fine[x])
+            --x;
+        return x;
+    }
+
+  private:
+    /// The last index in the ring buffer.
+    uint16_t index = 0;
+    /// The current (lower) median.
+    uint16_t median;
+    /// The number of inputs in the window that are less than the median.
+    count_t below = 0;
+    /// A ring buffer to keep track of the N last inputs.
+    uint16_t previousInputs[N];
+    /// The number of inputs in the window for each possible input value.
+    count_t fine[num_fine] = {};
+    /// The number of inputs in the window for each block of 2^fine_bits
+    /// possible input values.
+    count_t coarse[num_coarse] = {};
+};
+
+/// @}
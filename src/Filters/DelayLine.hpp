@@ -0,0 +1,85 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/algorithm>
+#include <AH/STL/cstdint>
+
+/// @addtogroup FilterImplementations
+/// @{
+
+/**
+ * @brief   Ring buffer of the @p N most recent values of a signal, with a
+ *          multiply-accumulate operation that doesn't require a rotated copy
+ *          of the coefficients.
+ *
+ * The classic way to get a contiguous multiply-accumulate window over a ring
+ * buffer is to store the coefficients twice (@f$ 2N - 1 @f$ values), so that
+ * the window can be shifted along with the index of the ring buffer.
+ * This class stores every coefficient only once instead. The ring buffer is
+ * split at the position of the oldest element, and the two resulting
+ * contiguous segments are multiplied with the two corresponding contiguous
+ * segments of the coefficients, both walking forward through memory.
+ *
+ * @tparam  N
+ *          The number of values to store.
+ * @tparam  T
+ *          The type of the values.
+ */
+template <uint8_t N, class T>
+class DelayLine {
+  public:
+    /// Construct a delay line with all values set to zero.
+    DelayLine() = default;
+
+    /// Construct a delay line with all values set to the given value.
+    DelayLine(T initialValue) {
+        std::fill(buffer.begin(), buffer.end(), initialValue);
+    }
+
+    /// Add a new value, overwriting the oldest one.
+    void push(T value) {
+        buffer[index] = value;
+        if (++index == N)
+            index = 0;
+    }
+
+    /**
+     * @brief   Compute the inner product of the stored values and the given
+     *          coefficients.
+     *
+     * @f[
+     * \sum_{j=0}^{N-1} h_j \cdot x[n - N + 1 + j]
+     * @f]
+     * where @f$ x[n] @f$ is the most recent value.
+     *
+     * @param   h
+     *          The @p N coefficients in reversed order, i.e. the first
+     *          coefficient is multiplied with the oldest value.
+     */
+    T mac(const T *h) const {
+        const uint8_t first = N - index;
+        const T *x = buffer.begin();
+        T acc = {};
+        // Oldest values first: from the index to the end of the buffer.
+        for (uint8_t j = 0; j < first; ++j)
+            acc += h[j] * x[index + j];
+        // Then from the start of the buffer to the most recent value.
+        for (uint8_t j = 0; j < index; ++j)
+            acc += h[first + j] * x[j];
+        return acc;
+    }
+
+    /// Get the value that was pushed @p i samples ago (zero is the most
+    /// recent value).
+    T operator[](uint8_t i) const {
+        uint8_t j = index > i ? index - 1 - i : index + N - 1 - i;
+        return buffer[j];
+    }
+
+  private:
+    /// The index of the oldest value, where the next value will be stored.
+    uint8_t index = 0;
+    AH::Array<T, N> buffer = {{}};
+};
+
+/// @}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <AH/STL/cmath>
+#include <AH/STL/complex>
+#include <Filters/AnalogPrototype.hpp>
+#include <Filters/ConstexprMath.hpp>
+#include <Filters/SOSFilter.hpp>
+
+/// @addtogroup FilterDesign
+/// @{
+
+/**
+ * @brief   Jacobi elliptic functions @f$ \operatorname{sn}(u|m) @f$,
+ *          @f$ \operatorname{cn}(u|m) @f$ and @f$ \operatorname{dn}(u|m) @f$.
+ *
+ * Uses the descending Landen transformation (arithmetic-geometric mean),
+ * with series expansions for @f$ m @f$ close to zero or one.
+ */
+inline void ellipj(double u, double m, double &sn, double &cn, double &dn) {
+    if (m < 1e-9) {
+        const double t = std::sin(u), b = std::cos(u);
+        const double ai = 0.25 * m * (u - t * b);
+        sn = t - ai * b;
+        cn = b + ai * t;
+        dn = 1 - 0.5 * m * t * t;
+        return;
+    }
+    if (m >= 0.9999999999) {
+        double ai = 0.25 * (1 - m);
+        const double b = std::cosh(u), t = std::tanh(u), phi = 1 / b;
+        const double twon = b * std::sinh(u);
+        sn = t + ai * (twon - u) / (b * b);
+        ai *= t * phi;
+        cn = phi - ai * (twon - u);
+        dn = phi + ai * (twon + u);
+        return;
+    }
+    double a[16] = {1}, c[16] = {std::sqrt(m)};
+    double b = std::sqrt(1 - m), twon = 1;
+    uint8_t i = 0;
+    while (std::abs(c[i] / a[i]) > 1e-16 && i < 15) {
+        const double ai = a[i];
+        ++i;
+        c[i] = (ai - b) / 2;
+        const double t = std::sqrt(ai * b);
+        a[i] = (ai + b) / 2;
+        b = t;
+        twon *= 2;
+    }
+    double phi = twon * a[i] * u, prev = phi;
+    for (; i > 0; --i) {
+        const double t = c[i] * std::sin(phi) / a[i];
+        prev = phi;
+        phi = (std::asin(t) + phi) / 2;
+    }
+    sn = std::sin(phi);
+    cn = std::cos(phi);
+    dn = cn / std::cos(phi - prev);
+}
+
+/**
+ * @brief   Analog elliptic low-pass prototype of order @p N with a pass band
+ *          ripple of @p r_pass decibels and a stop band attenuation of
+ *          @p r_stop decibels.
+ *
+ * Use it with @ref analog_prototype2sos_highpass,
+ * @ref analog_prototype2sos_bandpass or @ref analog_prototype2sos_bandstop to
+ * design other filter types.
+ *
+ * @see     @ref ellip_coeff
+ * @see     Sophocles J. Orfanidis, "Lecture notes on elliptic filter design",
+ *          <https://www.ece.rutgers.edu/~orfanidi/ece521/notes.pdf>
+ */
+template <uint8_t N>
+AnalogPrototype<N> ellip_prototype(double r_pass, double r_stop) {
+    static_assert(N > 0, "Order should be at least one");
+    using complex_t = std::complex<double>;
+    const double eps_sq = std::expm1(M_LN10 * r_pass / 10);
+    const double eps = std::sqrt(eps_sq);
+    AnalogPrototype<N> proto;
+    if (N == 1) {
+        proto.poles[0] = -1 / eps;
+        return proto;
+    }
+
+    // Selectivity k₁² = ε_p² / ε_s², and the degree equation N K'/K = K₁'/K₁
+    // solved for the modulus m = k² using the nome q = q₁^(1/N).
+    const double m1 = eps_sq / std::expm1(M_LN10 * r_stop / 10);
+    const double K1 = constexpr_ellipk(m1), K1p = constexpr_ellipkm1(m1);
+    const double q = std::exp(-M_PI * K1p / K1 / N);
+    double num = 0, den = 0;
+    for (uint8_t i = 0; i < 8; ++i) {
+        num += std::pow(q, i * (i + 1));
+        den += std::pow(q, (i + 1) * (i + 1));
+    }
+    const double m = 16 * q * std::pow(num / (1 + 2 * den), 4);
+    const double K = constexpr_ellipk(m);
+
+    // v₀ = K / (N K₁) · sc⁻¹(1/ε | k₁²), using the Landen transformation of
+    // sn⁻¹(j/ε | k₁²).
+    double ks[16] = {std::sqrt(m1)};
+    auto complement = [](complex_t k) { return std::sqrt((1. - k) * (1. + k)); };
+    uint8_t n = 0;
+    while (ks[n] > 0 && n < 15) {
+        const double kp = complement(ks[n]).real();
+        ks[n + 1] = (1 - kp) / (1 + kp);
+        ++n;
+    }
+    double Kl = M_PI_2;
+    complex_t w = {0, 1 / eps};
+    for (uint8_t i = 0; i < n; ++i) {
+        Kl *= 1 + ks[i + 1];
+        w = 2. * w / ((1 + ks[i + 1]) * (1. + complement(ks[i] * w)));
+    }
+    const double r = (Kl * std::asin(w) / M_PI_2).imag();
+    const double v0 = K * r / (N * K1);
+    double sv, cv, dv;
+    ellipj(v0, 1 - m, sv, cv, dv);
+
+    // Poles and zeros for u = j K / N, j = N - 1, N - 3, ..., ≥ 0
+    for (uint8_t k = 0; k < (N + 1) / 2; ++k) {
+        const int j = N - 1 - 2 * k;
+        double s, c, d;
+        ellipj(j * K / N, m, s, c, d);
+        const double den = 1 - (d * sv) * (d * sv);
+        proto.poles[k] = complex_t(-c * d * sv * cv, -s * dv) / den;
+        if (j > 0)
+            proto.zeros[proto.num_zeros++] = 1 / (std::sqrt(m) * s);
+    }
+    // Even order filters start at the bottom of the ripple.
+    proto.dc_gain = N % 2 ? 1 : 1 / std::sqrt(1 + eps_sq);
+    return proto;
+}
+
+/**
+ * @brief   Compute elliptic (Cauer) filter coefficients.
+ *
+ * Elliptic filters have an equiripple pass band with a maximum ripple of
+ * @p r_pass decibels, and an equiripple stop band with an attenuation of at
+ * least @p r_stop decibels. They have the steepest transition of all
+ * classical designs: for a given specification, they need the lowest order,
+ * and thus the fewest sections. Use @ref ellip_order to find the lowest
+ * order that meets a given specification.
+ *
+ * The result is equivalent to SciPy's
+ * `ellip(N, r_pass, r_stop, f_n, output='sos')`, see
+ * @ref analog_prototype2sos for the order of the sections and the
+ * distribution of the gain.
+ *
+ * @tparam  N
+ *          Order of the filter.
+ * @tparam  T
+ *          The type of the coefficients.
+ * @param   f_n
+ *          Normalized cut-off frequency in half-cycles per sample, the
+ *          frequency where the gain drops below @f$ -r_{pass} @f$ dB for the
+ *          last time.
+ * @param   r_pass
+ *          The maximum ripple in the pass band, in decibels.
+ * @param   r_stop
+ *          The minimum attenuation in the stop band, in decibels.
+ *
+ * @see     Sophocles J. Orfanidis, "Lecture notes on elliptic filter design",
+ *          <https://www.ece.rutgers.edu/~orfanidi/ece521/notes.pdf>
+ */
+template <uint8_t N, class T = float>
+SOSCoefficients<T, (N + 1) / 2> ellip_coeff(double f_n, double r_pass,
+                                            double r_stop) {
+    return analog_prototype2sos<T>(ellip_prototype<N>(r_pass, r_stop), f_n);
+}
+
+/**
+ * @brief   Create an elliptic (Cauer) filter, implemented as Second Order
+ *          Sections (SOS) filter.
+ *
+ * @see     @ref ellip_coeff
+ */
+template <uint8_t N, class T = float, class Implementation = BiQuadFilterDF1<T>>
+SOSFilter<T, (N + 1) / 2, Implementation> ellip(double f_n, double r_pass,
+                                                double r_stop) {
+    return ellip_coeff<N, T>(f_n, r_pass, r_stop);
+}
+
+/// @}
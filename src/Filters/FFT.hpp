@@ -0,0 +1,90 @@
+#pragma once
+
+#include <AH/STL/cmath>
+#include <AH/STL/complex>
+#include <AH/STL/utility>
+#include <AH/STL/vector>
+
+/// @addtogroup FilterImplementations
+/// @{
+
+/**
+ * @brief   Iterative radix-2 complex Fast Fourier Transform with precomputed
+ *          twiddle factors.
+ *
+ * @tparam  T
+ *          The floating point type of the real and imaginary parts.
+ */
+template <class T = float>
+class FFT {
+  public:
+    using complex_t = std::complex<T>;
+
+    /**
+     * @brief   Prepare a transform of the given size.
+     *
+     * @param   size
+     *          The length of the transform, must be a power of two.
+     */
+    FFT(size_t size)
+        : size(size), twiddles(size / 2), inverse_twiddles(size / 2),
+          permutation(size) {
+        for (size_t k = 0; k < size / 2; ++k) {
+            double phi = -2 * M_PI * double(k) / double(size);
+            twiddles[k] = complex_t(T(std::cos(phi)), T(std::sin(phi)));
+            inverse_twiddles[k] = std::conj(twiddles[k]);
+        }
+        // Bit-reversal permutation
+        for (size_t i = 1, j = 0; i < size; ++i) {
+            size_t bit = size >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+            permutation[i] = j;
+        }
+    }
+
+    /// Compute the forward transform of @p x in place.
+    void forward(complex_t *x) const { transform(x, false); }
+
+    /// Compute the inverse transform of @p x in place, without the scaling
+    /// factor @f$ 1 / N @f$.
+    void inverse(complex_t *x) const { transform(x, true); }
+
+    /// Get the length of the transform.
+    size_t getSize() const { return size; }
+
+    /// Complex multiplication without the special handling of infinities and
+    /// NaNs of `std::complex::operator*`, which prevents vectorization.
+    static complex_t mul(complex_t a, complex_t b) {
+        return {a.real() * b.real() - a.imag() * b.imag(),
+                a.real() * b.imag() + a.imag() * b.real()};
+    }
+
+  private:
+    void transform(complex_t *x, bool inverse) const {
+        for (size_t i = 1; i < size; ++i)
+            if (i < permutation[i])
+                std::swap(x[i], x[permutation[i]]);
+        const complex_t *w = inverse ? inverse_twiddles.data() : twiddles.data();
+        // Butterflies
+        for (size_t len = 2; len <= size; len <<= 1) {
+            const size_t half = len / 2, step = size / len;
+            for (size_t i = 0; i < size; i += len) {
+                for (size_t k = 0; k < half; ++k) {
+                    complex_t u = x[i + k];
+                    complex_t v = mul(x[i + k + half], w[k * step]);
+                    x[i + k] = u + v;
+                    x[i + k + half] = u - v;
+                }
+            }
+        }
+    }
+
+  private:
+    size_t size;
+    std::vector<complex_t> twiddles, inverse_twiddles;
+    std::vector<size_t> permutation;
+};
+
+/// @}
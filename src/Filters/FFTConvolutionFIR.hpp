@@ -0,0 +1,202 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/algorithm>
+#include <AH/STL/type_traits>
+#include <AH/STL/vector>
+#include <Filters/FFT.hpp>
+#include <Filters/FIRFilter.hpp>
+
+/// Number of taps below which @ref FFTConvolutionFIR uses the direct form
+/// instead of the FFT. Measured using `benchmarks/bench-FFTConvolution.cpp`
+/// for the default block size of 64 on x86-64 (SSE2).
+#ifndef FFT_CONVOLUTION_CROSSOVER
+#define FFT_CONVOLUTION_CROSSOVER 384
+#endif
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Finite Impulse Response filter for long impulse responses, using
+ *          uniformly partitioned overlap-save FFT convolution.
+ *
+ * Implements the same difference equation as @ref FIRFilter:
+ *
+ * @f[
+ * y[n] = \sum_{i=0}^{N-1} b_i \cdot x[n-i]
+ * @f]
+ *
+ * The first @p B coefficients are evaluated in direct form, so there is no
+ * extra latency, and outputs are available sample by sample.
+ * The remaining coefficients are split into partitions of @p B coefficients
+ * each. Their contribution to the next block of @p B outputs only depends on
+ * inputs that are already known, so it is computed once per block, using
+ * FFTs of length @f$ 2B @f$ and a frequency-domain delay line.
+ * The cost per sample is roughly @f$ B + 8 N / B + \mathcal{O}(\log B) @f$
+ * operations instead of @f$ N @f$.
+ *
+ * If @p N is smaller than @p Crossover, the FFT is not used at all, and all
+ * coefficients are evaluated in direct form.
+ *
+ * The state and coefficients are stored in dynamically allocated memory, this
+ * class is mainly intended for use on computers or larger microcontrollers.
+ *
+ * @tparam  N
+ *          The number of coefficients.
+ * @tparam  T
+ *          The floating point type of the signals and coefficients.
+ * @tparam  B
+ *          The block size, must be a power of two.
+ * @tparam  Crossover
+ *          The minimum number of coefficients to use the FFT.
+ */
+template <size_t N, class T = float, size_t B = 64,
+          size_t Crossover = FFT_CONVOLUTION_CROSSOVER>
+class FFTConvolutionFIR {
+    static_assert(std::is_floating_point<T>::value,
+                  "FFT convolution requires a floating point type");
+    static_assert(B > 0 && (B & (B - 1)) == 0,
+                  "Block size should be a power of two");
+
+  public:
+    /// Whether the FFT is used for the coefficients after the first block.
+    constexpr static bool uses_fft = N >= Crossover && N > B;
+    /// Number of coefficients evaluated in direct form.
+    constexpr static size_t direct_length = uses_fft ? B : N;
+    /// Number of partitions of the coefficients evaluated using the FFT.
+    constexpr static size_t partitions = uses_fft ? (N - 1) / B : 0;
+
+    /**
+     * @brief   Construct a new FFT Convolution FIR Filter object.
+     *
+     * @param   coefficients
+     *          The coefficients of the transfer function numerator.
+     */
+    FFTConvolutionFIR(const AH::Array<T, N> &coefficients)
+        : fft(uses_fft ? 2 * B : 1), buffer(H + B), direct(D), tail(B),
+          spectra(partitions * S), fdl(partitions * S),
+          work(uses_fft ? 2 * B : 0) {
+        for (size_t j = 0; j < D; ++j)
+            direct[j] = coefficients[D - 1 - j];
+        // Frequency response of each partition of the remaining coefficients,
+        // scaled by 1 / 2B to account for the unnormalized inverse FFT.
+        for (size_t q = 0; q < partitions; ++q) {
+            std::fill(work.begin(), work.end(), complex_t{});
+            for (size_t i = 0; i < B && B * (q + 1) + i < N; ++i)
+                work[i] = coefficients[B * (q + 1) + i] / T(2 * B);
+            fft.forward(work.data());
+            std::copy(work.begin(), work.begin() + S, &spectra[q * S]);
+        }
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        buffer[H + k] = input;
+        const T *x = &buffer[H + k + 1 - D];
+        T acc = tail[k];
+        for (size_t j = 0; j < D; ++j)
+            acc += direct[j] * x[j];
+        if (++k == B)
+            nextBlock();
+        return acc;
+    }
+
+    /**
+     * @brief   Filter a block of @p n inputs at once.
+     *
+     * Equivalent to calling @ref operator()() for each of the inputs, but
+     * uses @ref fir_block_kernel for the direct form part.
+     *
+     * @param   in
+     *          Pointer to the @p n inputs.
+     * @param   out
+     *          Pointer to where the @p n outputs should be stored. May be equal
+     *          to @p in.
+     * @param   n
+     *          The number of samples to filter.
+     */
+    void process(const T *in, T *out, size_t n) {
+        while (n > 0) {
+            size_t len = std::min(n, B - k);
+            std::copy(in, in + len, &buffer[H + k]);
+            fir_block_kernel(direct.data(), D, &buffer[H + k + 1 - D], out,
+                             len);
+            for (size_t i = 0; i < len; ++i)
+                out[i] += tail[k + i];
+            k += len;
+            in += len;
+            out += len;
+            n -= len;
+            if (k == B)
+                nextBlock();
+        }
+    }
+
+  private:
+    using complex_t = typename FFT<T>::complex_t;
+
+    /// Called after every @p B inputs: compute the contribution of the
+    /// partitioned coefficients to the next block of outputs, and shift the
+    /// history.
+    void nextBlock() {
+        if (uses_fft) {
+            // Spectrum of the two most recent blocks of inputs.
+            for (size_t i = 0; i < 2 * B; ++i)
+                work[i] = buffer[H - B + i];
+            fft.forward(work.data());
+            fdl_index = fdl_index == 0 ? partitions - 1 : fdl_index - 1;
+            std::copy(work.begin(), work.begin() + S, &fdl[fdl_index * S]);
+
+            // Multiply-accumulate the spectra of the partitions with the
+            // spectra of the corresponding older blocks of inputs. Real
+            // signals have a Hermitian spectrum, so only the first half is
+            // computed.
+            std::fill(work.begin(), work.begin() + S, complex_t{});
+            for (size_t q = 0; q < partitions; ++q) {
+                size_t p = fdl_index + q;
+                if (p >= partitions)
+                    p -= partitions;
+                const complex_t *G = &spectra[q * S];
+                const complex_t *Xq = &fdl[p * S];
+                for (size_t i = 0; i < S; ++i)
+                    work[i] += FFT<T>::mul(G[i], Xq[i]);
+            }
+            for (size_t i = S; i < 2 * B; ++i)
+                work[i] = std::conj(work[2 * B - i]);
+            fft.inverse(work.data());
+
+            // The last B samples are free of circular aliasing.
+            for (size_t i = 0; i < B; ++i)
+                tail[i] = work[B + i].real();
+        }
+        std::copy(buffer.begin() + B, buffer.end(), buffer.begin());
+        k = 0;
+    }
+
+  private:
+    constexpr static size_t D = direct_length;
+    /// Number of previous inputs to keep in the linear history.
+    constexpr static size_t H = uses_fft ? B : D - 1;
+    /// Number of unique frequency bins of a real signal of length 2B.
+    constexpr static size_t S = B + 1;
+
+    FFT<T> fft;
+    size_t k = 0;         ///< Index of the current input in the block.
+    size_t fdl_index = 0; ///< Index of the most recent input spectrum.
+    std::vector<T> buffer;          ///< Previous inputs and current block.
+    std::vector<T> direct;          ///< Reversed direct-form coefficients.
+    std::vector<T> tail;            ///< Partitioned outputs of this block.
+    std::vector<complex_t> spectra; ///< Spectra of the partitions.
+    std::vector<complex_t> fdl;     ///< Frequency-domain delay line.
+    std::vector<complex_t> work;
+};
+
+/// @}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <Filters/DelayLine.hpp>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Finite Impulse Response filter followed by downsampling by a factor
+ *          @p M, using a polyphase implementation.
+ *
+ * Computes every @p M -th output of the FIR filter:
+ *
+ * @f[
+ * y[m] = \sum_{i=0}^{N-1} b_i \cdot x[mM + M - 1 - i]
+ * @f]
+ *
+ * Filtering with @ref FIRFilter and then discarding @f$ M - 1 @f$ out of every
+ * @p M outputs requires @f$ N @f$ multiplications per input. This class
+ * splits the coefficients into @p M polyphase branches of
+ * @f$ K = \lceil N / M \rceil @f$ coefficients each:
+ * branch @f$ p @f$ contains @f$ b_p, b_{p+M}, b_{p+2M}, \ldots @f$, and only
+ * sees the inputs with the corresponding phase. Each new input is pushed into
+ * its own branch, and only that branch is evaluated, so the cost is @f$ K @f$
+ * multiplications per input (@f$ N @f$ per output), evenly spread out over
+ * the inputs.
+ *
+ * Use @ref update() with each new input, it returns true when a new output
+ * is available, which can then be retrieved using @ref getValue().
+ *
+ * @tparam  N
+ *          The number of coefficients.
+ * @tparam  M
+ *          The decimation factor.
+ * @tparam  T
+ *          The type of the signals and coefficients.
+ */
+template <uint8_t N, uint8_t M, class T = float>
+class FIRDecimator {
+  public:
+    /// The number of coefficients per polyphase branch.
+    constexpr static uint8_t K = (N + M - 1) / M;
+
+    /**
+     * @brief   Construct a new FIR Decimator object.
+     *
+     * @param   coefficients
+     *          The coefficients of the transfer function numerator of the
+     *          (anti-aliasing) FIR filter.
+     */
+    FIRDecimator(const AH::Array<T, N> &coefficients) {
+        // Polyphase order, each branch reversed for DelayLine::mac.
+        for (uint8_t p = 0; p < M; ++p) {
+            for (uint8_t k = 0; k < K; ++k) {
+                uint16_t i = p + uint16_t(k) * M;
+                this->coefficients[p][K - 1 - k] =
+                    i < N ? coefficients[i] : T{};
+            }
+        }
+    }
+
+    /**
+     * @brief   Update the internal state with a new input.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$.
+     * @retval  true
+     *          A new output is available, and can be retrieved using
+     *          @ref getValue(). This is the case for every @p M -th input.
+     * @retval  false
+     *          No new output yet.
+     */
+    bool update(T input) {
+        branches[phase].push(input);
+        acc += branches[phase].mac(coefficients[phase].begin());
+        if (phase == 0) {
+            output = acc;
+            acc = T{};
+            phase = M - 1;
+            return true;
+        }
+        --phase;
+        return false;
+    }
+
+    /// Get the most recent output @f$ y[m] @f$.
+    T getValue() const { return output; }
+
+    /**
+     * @brief   Update the internal state with @p M new inputs and return the
+     *          new output.
+     *
+     * @param   inputs
+     *          Pointer to @p M consecutive inputs.
+     * @return  The new output @f$ y[m] @f$. Only includes all of the
+     *          @p M inputs if the decimator was at the start of a block, i.e.
+     *          if it was only updated in blocks of @p M inputs so far.
+     */
+    T operator()(const T *inputs) {
+        for (uint8_t i = 0; i < M; ++i)
+            update(inputs[i]);
+        return output;
+    }
+
+  private:
+    uint8_t phase = M - 1; ///< Phase of the next input.
+    T acc = {};            ///< Partial sum of the current output.
+    T output = {};         ///< Most recent complete output.
+    AH::Array<DelayLine<K, T>, M> branches = {};
+    AH::Array<AH::Array<T, K>, M> coefficients;
+};
+
+/// @}
@@ -1,6 +1,67 @@
 #pragma once
 
 #include <AH/Containers/Array.hpp>
+#include <AH/STL/algorithm>
+#include <Filters/DelayLine.hpp>
+#include <Filters/SIMD.hpp>
+
+/// @addtogroup FilterImplementations
+/// @{
+
+/**
+ * @brief   Compute @p n outputs of an FIR filter with a linear history.
+ * 
+ * @f[
+ * y[k] = \sum_{j=0}^{N-1} h_j \cdot x[k+j]
+ * @f]
+ * 
+ * Multiple consecutive outputs are accumulated in parallel in the lanes of a 
+ * @ref SIMDPack, each output sums its terms in order of @p j, so each lane 
+ * performs exactly the same operations as the scalar loop.
+ * 
+ * @param   h
+ *          The @p N coefficients in reversed order.
+ * @param   N
+ *          The number of coefficients.
+ * @param   x
+ *          The @f$ n + N - 1 @f$ inputs, oldest first.
+ * @param   y
+ *          Pointer to where the @p n outputs should be stored. Should not 
+ *          overlap with @p x.
+ * @param   n
+ *          The number of outputs to compute.
+ */
+template <class T>
+void fir_block_kernel(const T *h, size_t N, const T *x, T *y, size_t n) {
+    using V = SIMDPack<T>;
+    constexpr size_t W = V::lanes;
+    size_t k = 0;
+    // Two independent accumulators to hide the latency of the additions.
+    for (; k + 2 * W <= n; k += 2 * W) {
+        V acc0 = V::zero(), acc1 = V::zero();
+        for (size_t j = 0; j < N; ++j) {
+            V hj = V::broadcast(h[j]);
+            acc0 += hj * V::load(x + k + j);
+            acc1 += hj * V::load(x + k + j + W);
+        }
+        acc0.store(y + k);
+        acc1.store(y + k + W);
+    }
+    for (; k + W <= n; k += W) {
+        V acc = V::zero();
+        for (size_t j = 0; j < N; ++j)
+            acc += V::broadcast(h[j]) * V::load(x + k + j);
+        acc.store(y + k);
+    }
+    for (; k < n; ++k) {
+        T acc = {};
+        for (size_t j = 0; j < N; ++j)
+            acc += h[j] * x[k + j];
+        y[k] = acc;
+    }
+}
+
+/// @}
 
 /// @addtogroup Filters
 /// @{
@@ -62,10 +123,105 @@ class FIRFilter {
         return acc;
     }
 
+    /**
+     * @brief   Filter a block of @p n inputs at once.
+     * 
+     * Equivalent to calling @ref operator()() for each of the inputs, but 
+     * computes several outputs per pass over the coefficients, using SIMD
+     * instructions if available. For integer types, the result is 
+     * bit-identical to the sample-by-sample version.
+     * 
+     * Uses a temporary buffer of @f$ N - 1 + @ref block_size @f$ elements
+     * on the stack.
+     * 
+     * @param   in 
+     *          Pointer to the @p n inputs.
+     * @param   out 
+     *          Pointer to where the @p n outputs should be stored. May be equal
+     *          to @p in.
+     * @param   n 
+     *          The number of samples to filter.
+     */
+    void process(const T *in, T *out, size_t n) {
+        // Linear buffer: the N - 1 previous inputs in chronological order, 
+        // followed by a block of new inputs.
+        T buf[N - 1 + block_size];
+        for (uint8_t i = 0; i < N - 1; ++i)
+            buf[i] = x[(index_b + 1 + i) % N];
+
+        while (n > 0) {
+            size_t len = n < block_size ? n : block_size;
+            std::copy(in, in + len, buf + N - 1);
+            // The first N coefficients are the reversed coefficients b.
+            fir_block_kernel(coefficients.begin(), N, buf, out, len);
+            std::copy(buf + len, buf + len + N - 1, buf);
+            in += len;
+            out += len;
+            n -= len;
+        }
+
+        // Save the N - 1 most recent inputs back to the ring buffer, with the
+        // oldest one at index zero.
+        std::copy(buf, buf + N - 1, x.begin());
+        index_b = N - 1;
+    }
+
+    /// The number of inputs processed per pass in @ref process.
+    constexpr static size_t block_size = 4 * SIMDPack<T>::lanes;
+
   private:
     uint8_t index_b = 0;
     AH::Array<T, N> x = {};
     AH::Array<T, 2 * N - 1> coefficients;
 };
 
+/** 
+ * @brief   Finite Impulse Response filter implementation that stores every
+ *          coefficient only once.
+ * 
+ * Implements the same difference equation as @ref FIRFilter:
+ * 
+ * @f[
+ * y[n] = \sum_{i=0}^{N-1} b_i \cdot x[n-i]
+ * @f]
+ * 
+ * @ref FIRFilter keeps @f$ 2N - 1 @f$ coefficients so that it can use a single
+ * contiguous multiply-accumulate window, this class uses a @ref DelayLine 
+ * instead, which walks the ring buffer in two contiguous segments.
+ * It requires @f$ 2N @f$ instead of @f$ 3N - 1 @f$ elements of memory, at the
+ * cost of a second (shorter) inner loop.
+ * For integer types, the results are identical to those of @ref FIRFilter.
+ */
+template <uint8_t N, class T = float>
+class CompactFIRFilter {
+  public:
+    /**
+     * @brief   Construct a new Compact FIR Filter object.
+     * 
+     * @param   coefficients 
+     *          The coefficients of the transfer function numerator.
+     */
+    CompactFIRFilter(const AH::Array<T, N> &coefficients) {
+        for (uint8_t i = 0; i < N; ++i)
+            this->coefficients[i] = coefficients[N - 1 - i];
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     * 
+     * @param   input 
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        x.push(input);
+        return x.mac(coefficients.begin());
+    }
+
+  private:
+    DelayLine<N, T> x = {};
+    AH::Array<T, N> coefficients; ///< Reversed coefficients
+};
+
 /// @}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/algorithm>
+#include <Filters/SIMD.hpp>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Bank of @p C identical Finite Impulse Response filters, one for
+ *          each channel of a multi-channel signal.
+ *
+ * Implements the following difference equation for every channel @f$ c @f$:
+ *
+ * @f[
+ * y_c[n] = \sum_{i=0}^{N-1} b_i \cdot x_c[n-i]
+ * @f]
+ *
+ * All channels share a single copy of the coefficients. The histories of the
+ * channels are stored interleaved: the inputs of all channels at the same
+ * time step (a frame) are contiguous in memory. This way, every coefficient
+ * is loaded only once per frame, and multiplied with @ref SIMDPack::lanes
+ * channels at a time. Channels that don't fill up a complete pack are
+ * handled one by one.
+ *
+ * The total memory usage is @f$ N + C N @f$ elements, compared to
+ * @f$ C (3N - 1) @f$ for @p C separate instances of @ref FIRFilter.
+ * Each channel performs the same operations in the same order as
+ * @ref CompactFIRFilter, so the results are identical.
+ *
+ * @tparam  N
+ *          The number of coefficients.
+ * @tparam  C
+ *          The number of channels.
+ * @tparam  T
+ *          The type of the signals and coefficients.
+ */
+template <uint8_t N, uint8_t C, class T = float>
+class FIRFilterBank {
+  public:
+    /**
+     * @brief   Construct a new FIR Filter Bank object.
+     *
+     * @param   coefficients
+     *          The coefficients of the transfer function numerator, shared by
+     *          all channels.
+     */
+    FIRFilterBank(const AH::Array<T, N> &coefficients) {
+        for (uint8_t i = 0; i < N; ++i)
+            this->coefficients[i] = coefficients[N - 1 - i];
+    }
+
+    /**
+     * @brief   Update the internal state with a new frame of inputs
+     *          @f$ x_c[n] @f$ and return the new frame of outputs
+     *          @f$ y_c[n] @f$.
+     *
+     * @param   input
+     *          The new inputs @f$ x_c[n] @f$, one for each channel.
+     * @return  The new outputs @f$ y_c[n] @f$, one for each channel.
+     */
+    AH::Array<T, C> operator()(const AH::Array<T, C> &input) {
+        AH::Array<T, C> output;
+        (*this)(input.begin(), output.begin());
+        return output;
+    }
+
+    /**
+     * @brief   Update the internal state with a new frame of inputs
+     *          @f$ x_c[n] @f$ and write the new frame of outputs
+     *          @f$ y_c[n] @f$ to the given buffer.
+     *
+     * @param   input
+     *          Pointer to the @p C new inputs.
+     * @param   output
+     *          Pointer to where the @p C new outputs should be stored. May be
+     *          equal to @p input.
+     */
+    void operator()(const T *input, T *output) {
+        T *x = buffer.begin();
+        std::copy(input, input + C, x + index * C);
+        if (++index == N)
+            index = 0;
+
+        // Oldest frames first: from the index to the end of the buffer, then
+        // from the start of the buffer to the most recent frame.
+        const T *h = coefficients.begin();
+        const uint8_t first = N - index;
+        const T *x_old = x + index * C;
+        uint8_t c = 0;
+        for (; c + P::lanes <= C; c += P::lanes) {
+            P acc = P::zero();
+            for (uint8_t j = 0; j < first; ++j)
+                acc += P::broadcast(h[j]) * P::load(x_old + j * C + c);
+            for (uint8_t j = 0; j < index; ++j)
+                acc += P::broadcast(h[first + j]) * P::load(x + j * C + c);
+            acc.store(output + c);
+        }
+        for (; c < C; ++c) {
+            T acc = {};
+            for (uint8_t j = 0; j < first; ++j)
+                acc += h[j] * x_old[j * C + c];
+            for (uint8_t j = 0; j < index; ++j)
+                acc += h[first + j] * x[j * C + c];
+            output[c] = acc;
+        }
+    }
+
+  private:
+    using P = SIMDPack<T>;
+
+    /// The index of the oldest frame, where the next frame will be stored.
+    uint8_t index = 0;
+    /// Frame-major (interleaved) history of all channels.
+    AH::Array<T, N * C> buffer = {{}};
+    /// Reversed coefficients, the first one is multiplied with the oldest
+    /// frame.
+    AH::Array<T, N> coefficients;
+};
+
+/// @}
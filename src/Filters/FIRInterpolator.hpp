@@ -0,0 +1,99 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <Filters/DelayLine.hpp>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Upsampling by a factor @p L followed by a Finite Impulse Response
+ *          filter, using a polyphase implementation.
+ *
+ * Computes the output of the FIR filter applied to the input signal with
+ * @f$ L - 1 @f$ zeros inserted after every sample:
+ *
+ * @f[
+ * y[mL + j] = \sum_{k=0}^{K-1} b_{j + kL} \cdot x[m - k]
+ * \quad\text{for}\quad j = 0, 1, \ldots, L - 1
+ * @f]
+ *
+ * Zero-stuffing the input of an @ref FIRFilter wastes most multiplications on
+ * zeros. This class splits the coefficients into @p L polyphase branches of
+ * @f$ K = \lceil N / L \rceil @f$ coefficients each: branch @f$ j @f$
+ * contains @f$ b_j, b_{j+L}, b_{j+2L}, \ldots @f$, and computes the
+ * @f$ j @f$-th output of every group of @p L outputs. All branches share the
+ * same history of inputs. In total, this requires @f$ N @f$ multiplications
+ * per input (rounded up to a multiple of @p L).
+ *
+ * @note    Inserting zeros reduces the average signal level by a factor
+ *          @p L, so the DC gain of the filter coefficients should be @p L to
+ *          preserve the signal level.
+ *
+ * @tparam  N
+ *          The number of coefficients.
+ * @tparam  L
+ *          The interpolation factor.
+ * @tparam  T
+ *          The type of the signals and coefficients.
+ */
+template <uint8_t N, uint8_t L, class T = float>
+class FIRInterpolator {
+  public:
+    /// The number of coefficients per polyphase branch.
+    constexpr static uint8_t K = (N + L - 1) / L;
+
+    /**
+     * @brief   Construct a new FIR Interpolator object.
+     *
+     * @param   coefficients
+     *          The coefficients of the transfer function numerator of the
+     *          (anti-imaging) FIR filter.
+     */
+    FIRInterpolator(const AH::Array<T, N> &coefficients) {
+        // Polyphase order, each branch reversed for DelayLine::mac.
+        for (uint8_t j = 0; j < L; ++j) {
+            for (uint8_t k = 0; k < K; ++k) {
+                uint16_t i = j + uint16_t(k) * L;
+                this->coefficients[j][K - 1 - k] =
+                    i < N ? coefficients[i] : T{};
+            }
+        }
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[m] @f$ and
+     *          return the @p L new outputs @f$ y[mL], y[mL + 1], \ldots,
+     *          y[mL + L - 1] @f$.
+     *
+     * @param   input
+     *          The new input @f$ x[m] @f$.
+     * @return  The @p L new outputs, oldest first.
+     */
+    AH::Array<T, L> operator()(T input) {
+        AH::Array<T, L> outputs;
+        (*this)(input, outputs.begin());
+        return outputs;
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[m] @f$ and
+     *          write the @p L new outputs to the given buffer.
+     *
+     * @param   input
+     *          The new input @f$ x[m] @f$.
+     * @param   outputs
+     *          Pointer to where the @p L new outputs should be stored.
+     */
+    void operator()(T input, T *outputs) {
+        x.push(input);
+        for (uint8_t j = 0; j < L; ++j)
+            outputs[j] = x.mac(coefficients[j].begin());
+    }
+
+  private:
+    DelayLine<K, T> x = {};
+    AH::Array<AH::Array<T, K>, L> coefficients;
+};
+
+/// @}
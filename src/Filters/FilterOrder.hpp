@@ -0,0 +1,183 @@
+#pragma once
+
+#include <AH/STL/cstdint>
+#include <AH/STL/limits>
+#include <Filters/ConstexprMath.hpp>
+
+/// @addtogroup FilterDesign
+/// @{
+
+/// The result of an order estimation: the lowest order that meets the
+/// specification, and the matching cut-off frequency parameter of the
+/// corresponding design function.
+struct FilterOrder {
+    /// The order of the filter, or zero if the specification is invalid or if
+    /// no order up to 255 meets it.
+    uint8_t N;
+    /// Normalized cut-off frequency (in half-cycles per sample) to pass to the
+    /// design function.
+    double f_n;
+};
+
+/// @cond HIDDEN_SYMBOLS
+/// Returned by the order estimation functions if the arguments don't describe
+/// a low-pass specification. This function is deliberately not constexpr, so
+/// an invalid specification in a constant expression is a compile-time error.
+inline FilterOrder invalid_filter_specification() { return {0, 0}; }
+/// Returned by @ref LowpassSpec::ceil if the required order doesn't fit in
+/// `uint8_t`. Not constexpr either, for the same reason.
+inline uint8_t no_filter_order_fits_specification() { return 0; }
+
+/// Low-pass specification pre-warped to the analog domain, shared by all order
+/// estimation functions.
+struct LowpassSpec {
+    FILTERS_CONSTEXPR14 LowpassSpec(double f_pass, double f_stop,
+                                    double r_pass, double r_stop)
+        : passb(constexpr_tan(M_PI * f_pass / 2)),
+          nat(constexpr_tan(M_PI * f_stop / 2) / passb),
+          gpass_m1(constexpr_exp(M_LN10 * r_pass / 10) - 1),
+          gstop_m1(constexpr_exp(M_LN10 * r_stop / 10) - 1) {}
+    double passb;    ///< Pre-warped pass band edge
+    double nat;      ///< Ratio of stop band edge to pass band edge
+    double gpass_m1; ///< @f$ 10^{r_{pass}/10} - 1 @f$
+    double gstop_m1; ///< @f$ 10^{r_{stop}/10} - 1 @f$
+
+    /// Check that @f$ 0 < f_{pass} < f_{stop} < 1 @f$, and that both ripple
+    /// and attenuation are positive and finite (this also rejects NaN).
+    static constexpr bool valid(double f_pass, double f_stop, double r_pass,
+                                double r_stop) {
+        return 0 < f_pass && f_pass < f_stop && f_stop < 1 && //
+               0 < r_pass && r_pass < std::numeric_limits<double>::max() &&
+               0 < r_stop && r_stop < std::numeric_limits<double>::max();
+    }
+
+    /// Round up to the nearest order (at least one), or return zero if that
+    /// order is higher than 255.
+    static FILTERS_CONSTEXPR14 uint8_t ceil(double x) {
+        if (!(x <= 255)) // converting to uint8_t would be undefined
+            return no_filter_order_fits_specification();
+        uint8_t n = x > 1 ? uint8_t(x) : 1;
+        return double(n) < x ? n + 1 : n;
+    }
+    /// Convert a pre-warped analog frequency back to a normalized digital one.
+    static FILTERS_CONSTEXPR14 double unwarp(double w) {
+        return constexpr_atan(w) * 2 / M_PI;
+    }
+};
+/// @endcond
+
+/**
+ * @brief   Find the lowest order of a Butterworth low-pass filter that loses
+ *          no more than @p r_pass dB in the pass band and has at least
+ *          @p r_stop dB of attenuation in the stop band.
+ *
+ * All order estimation functions can be evaluated at compile time (in
+ * C++14 or later), so the result can be used as the order template parameter
+ * of the design function:
+ *
+ * ~~~cpp
+ * constexpr FilterOrder order = butter_order(0.1, 0.2, 1, 40);
+ * auto filter = butter<order.N>(order.f_n);
+ * ~~~
+ *
+ * The results are the same as SciPy's `buttord`, `cheb1ord`, `cheb2ord` and
+ * `ellipord`.
+ *
+ * If the arguments are not a valid specification (see the parameters below),
+ * the returned order is zero, or, in a constant expression, compilation fails
+ * with an error that mentions `invalid_filter_specification`. The same goes
+ * for specifications that need an order higher than 255, where the error
+ * mentions `no_filter_order_fits_specification`.
+ *
+ * @param   f_pass
+ *          Normalized pass band edge frequency in half-cycles per sample,
+ *          @f$ f_n = \frac{2 f}{f_s} \in \left[0, 1\right] @f$.
+ * @param   f_stop
+ *          Normalized stop band edge frequency in half-cycles per sample,
+ *          must be higher than @p f_pass and lower than one.
+ * @param   r_pass
+ *          The maximum loss in the pass band, in decibels, must be positive
+ *          and finite.
+ * @param   r_stop
+ *          The minimum attenuation in the stop band, in decibels, must be
+ *          positive and finite.
+ * @return  The order, and the normalized cut-off frequency for
+ *          @ref butter_coeff (the frequency where the gain is 3 dB down),
+ *          chosen to meet the pass band specification exactly.
+ */
+FILTERS_CONSTEXPR14 FilterOrder butter_order(double f_pass, double f_stop,
+                                             double r_pass, double r_stop) {
+    if (!LowpassSpec::valid(f_pass, f_stop, r_pass, r_stop))
+        return invalid_filter_specification();
+    const LowpassSpec s = {f_pass, f_stop, r_pass, r_stop};
+    const uint8_t N = LowpassSpec::ceil(
+        constexpr_log(s.gstop_m1 / s.gpass_m1) / (2 * constexpr_log(s.nat)));
+    if (N == 0)
+        return {0, 0};
+    const double w0 = constexpr_exp(-constexpr_log(s.gpass_m1) / (2 * N));
+    return {N, LowpassSpec::unwarp(w0 * s.passb)};
+}
+
+/**
+ * @brief   Find the lowest order of a Chebyshev type I low-pass filter that
+ *          meets the given specification.
+ *
+ * @copydetails butter_order
+ * @return  The order, and the normalized cut-off frequency for
+ *          @ref cheby1_coeff, which is equal to @p f_pass.
+ */
+FILTERS_CONSTEXPR14 FilterOrder cheby1_order(double f_pass, double f_stop,
+                                             double r_pass, double r_stop) {
+    if (!LowpassSpec::valid(f_pass, f_stop, r_pass, r_stop))
+        return invalid_filter_specification();
+    const LowpassSpec s = {f_pass, f_stop, r_pass, r_stop};
+    const double v = constexpr_acosh(constexpr_sqrt(s.gstop_m1 / s.gpass_m1));
+    const uint8_t N = LowpassSpec::ceil(v / constexpr_acosh(s.nat));
+    return {N, N == 0 ? 0 : f_pass};
+}
+
+/**
+ * @brief   Find the lowest order of a Chebyshev type II low-pass filter that
+ *          meets the given specification.
+ *
+ * @copydetails butter_order
+ * @return  The order, and the normalized stop band edge frequency for
+ *          @ref cheby2_coeff, chosen to meet the pass band specification
+ *          exactly.
+ */
+FILTERS_CONSTEXPR14 FilterOrder cheby2_order(double f_pass, double f_stop,
+                                             double r_pass, double r_stop) {
+    if (!LowpassSpec::valid(f_pass, f_stop, r_pass, r_stop))
+        return invalid_filter_specification();
+    const LowpassSpec s = {f_pass, f_stop, r_pass, r_stop};
+    const double v = constexpr_acosh(constexpr_sqrt(s.gstop_m1 / s.gpass_m1));
+    const uint8_t N = LowpassSpec::ceil(v / constexpr_acosh(s.nat));
+    if (N == 0)
+        return {0, 0};
+    const double new_freq = constexpr_cosh(v / N);
+    return {N, LowpassSpec::unwarp(s.passb * new_freq)};
+}
+
+/**
+ * @brief   Find the lowest order of an elliptic low-pass filter that meets the
+ *          given specification.
+ *
+ * @copydetails butter_order
+ * @return  The order, and the normalized cut-off frequency for
+ *          @ref ellip_coeff, which is equal to @p f_pass.
+ */
+FILTERS_CONSTEXPR14 FilterOrder ellip_order(double f_pass, double f_stop,
+                                            double r_pass, double r_stop) {
+    if (!LowpassSpec::valid(f_pass, f_stop, r_pass, r_stop))
+        return invalid_filter_specification();
+    const LowpassSpec s = {f_pass, f_stop, r_pass, r_stop};
+    // Degree equation: N = K(k) K'(k₁) / (K'(k) K(k₁)), with selectivity
+    // k = 1 / nat and discrimination k₁ = √(gpass_m1 / gstop_m1).
+    const double m = 1 / (s.nat * s.nat), m1 = s.gpass_m1 / s.gstop_m1;
+    const uint8_t N =
+        LowpassSpec::ceil(constexpr_ellipk(m) * constexpr_ellipkm1(m1) /
+                          (constexpr_ellipkm1(m) * constexpr_ellipk(m1)));
+    return {N, N == 0 ? 0 : f_pass};
+}
+
+/// @}
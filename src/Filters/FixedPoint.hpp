@@ -6,6 +6,7 @@
 #include <AH/STL/type_traits>
 
 #include <AH/Error/Error.hpp>
+#include <Filters/Overflow.hpp>
 
 template <class T>
 struct DoubleWidthInt {
@@ -59,8 +60,15 @@ using DoubleWidthInt_t = typename DoubleWidthInt<T>::type;
  * @tparam  T2 
  *          The integer type to use for intermediate values when mutliplying or
  *          dividing.
+ * @tparam  Overflow
+ *          What to do when the result of an operation doesn't fit in @p T:
+ *          @ref OverflowWrap (default), @ref OverflowSaturate or
+ *          @ref OverflowSaturateCount. Fixed-point numbers are values, not
+ *          objects with a lifetime, so the policy (and its statistics) are
+ *          shared by all numbers of the same type, see @ref overflowPolicy().
  */
-template <class T, uint8_t N, class T2 = DoubleWidthInt_t<T>>
+template <class T, uint8_t N, class T2 = DoubleWidthInt_t<T>,
+          class Overflow = OverflowWrap>
 class FixedPoint {
   public:
     /// Fixed-point representation of the number one.
@@ -71,7 +79,8 @@ class FixedPoint {
 
     /// Initialize U from a numeric value.
     template <class U>
-    FixedPoint(U f) : val(std::llrint(f * one)) {}
+    FixedPoint(U f)
+        : val(overflow().template narrow<T>(std::llrint(f * one))) {}
 
     /// Convert a raw integer representation to fixed point type.
     static constexpr FixedPoint raw(T t) {
@@ -82,29 +91,16 @@ class FixedPoint {
 
     /// Addition.
     FixedPoint operator+(FixedPoint rhs) const {
-        // if (rhs.val > 0 &&
-        //     this->val > std::numeric_limits<T>::max() - rhs.val) {
-        //     ERROR("Integer overflow", 0x0FF0);
-        //     return raw(std::numeric_limits<T>::max());
-        // }
-        // if (rhs.val < 0 &&
-        //     this->val < std::numeric_limits<T>::min() - rhs.val) {
-        //     ERROR("Integer underflow", 0x0FF1);
-        //     return raw(std::numeric_limits<T>::min());
-        // }
-        return raw(static_cast<T>(
-            static_cast<typename std::make_unsigned<T>::type>(this->val) +
-            static_cast<typename std::make_unsigned<T>::type>(rhs.val)));
+        return raw(overflow().add(this->val, rhs.val));
     }
 
     /// Subtraction.
     FixedPoint operator-(FixedPoint rhs) const {
-        // return raw(this->val - rhs.val);
-        return *this + -rhs;
+        return raw(overflow().sub(this->val, rhs.val));
     }
 
     /// Invert.
-    FixedPoint operator-() const { return raw(-this->val); }
+    FixedPoint operator-() const { return raw(overflow().sub(T(0), val)); }
 
     /// Multiplication.
     FixedPoint operator*(FixedPoint rhs) const {
@@ -118,7 +114,8 @@ class FixedPoint {
     FixedPoint operator/(FixedPoint rhs) const {
         if (rhs.val == one)
             return raw(this->val);
-        return raw(T2(this->val) * one / rhs.val);
+        return raw(overflow().template narrow<T>(T2(this->val) * one /
+                                                 rhs.val));
     }
 
     /// Divide the given integer by @f$ 2^N @f$.
@@ -126,26 +123,38 @@ class FixedPoint {
         static_assert(std::is_unsigned<T2>::value || (-97 * 2) >> 1 == -97,
                       "Negative signed right shift incorrect");
         int neg = val < 0 ? 1 : 0;
-        return (val + (1 << (N - 1)) - neg) >> N;
+        return overflow().template narrow<T>((val + (1 << (N - 1)) - neg) >>
+                                             N);
     }
 
     explicit operator long double() const { return (long double)val / one; }
     explicit operator double() const { return (double)val / one; }
     explicit operator float() const { return (float)val / one; }
 
+    /// Get the overflow policy shared by all numbers of this type, e.g. to
+    /// read the statistics of @ref OverflowSaturateCount.
+    static Overflow &overflowPolicy() { return overflow(); }
+
+  private:
+    static Overflow &overflow() { return overflow_policy; }
+    static Overflow overflow_policy;
+
   private:
     T val;
 };
 
+template <class T, uint8_t N, class T2, class Overflow>
+Overflow FixedPoint<T, N, T2, Overflow>::overflow_policy;
+
 /// Multiply normal integer with fixed point integer.
-template <class T, uint8_t N, class T2>
-T2 operator*(T lhs, FixedPoint<T, N, T2> rhs) {
+template <class T, uint8_t N, class T2, class O>
+T2 operator*(T lhs, FixedPoint<T, N, T2, O> rhs) {
     return rhs * lhs;
 }
 
 /// Multiply normal integer with fixed point integer.
-template <class T, uint8_t N, class T2>
-T2 operator*(T2 lhs, FixedPoint<T, N, T2> rhs) {
+template <class T, uint8_t N, class T2, class O>
+T2 operator*(T2 lhs, FixedPoint<T, N, T2, O> rhs) {
     return rhs * lhs;
 }
 
@@ -154,8 +163,8 @@ T2 operator*(T2 lhs, FixedPoint<T, N, T2> rhs) {
 #include <iosfwd>
 
 /// Printing a fixed-point integer.
-template <class T, class T2, uint8_t N>
-std::ostream &operator<<(std::ostream &os, FixedPoint<T, N, T2> fp) {
+template <class T, class T2, uint8_t N, class O>
+std::ostream &operator<<(std::ostream &os, FixedPoint<T, N, T2, O> fp) {
     return os << double(fp);
 }
 
@@ -164,8 +173,8 @@ std::ostream &operator<<(std::ostream &os, FixedPoint<T, N, T2> fp) {
 #include <AH/PrintStream/PrintStream.hpp>
 
 /// Printing a fixed-point integer.
-template <class T, uint8_t N, class T2>
-Print &operator<<(Print &os, FixedPoint<T, N, T2> fp) {
+template <class T, uint8_t N, class T2, class O>
+Print &operator<<(Print &os, FixedPoint<T, N, T2, O> fp) {
     return os << double(fp);
 }
 
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/cmath>
+#include <AH/STL/cstdint>
+#include <AH/STL/limits>
+#include <AH/STL/type_traits>
+#include <Filters/FixedPoint.hpp>
+#include <Filters/SOSFilter.hpp>
+
+/// @addtogroup FilterImplementations
+/// @{
+
+/**
+ * @brief   BiQuad filter for Q15 or Q31 fixed-point signals, for
+ *          microcontrollers without a floating point unit.
+ *
+ * Implements the following difference equation using the Direct Form 1:
+ *
+ * @f[
+ * y[n] = \frac{b_0 \cdot x[n] + b_1 \cdot x[n-1] + b_2 \cdot x[n-2]
+ *            - a_1 \cdot y[n-1] - a_2 \cdot y[n-2]}{a_0}
+ * @f]
+ *
+ * The signals are raw integers of type @p T, interpreted as fractions
+ * @f$ x / 2^{B-1} \in [-1, 1) @f$, where @f$ B @f$ is the number of bits of
+ * @p T (Q15 for `int16_t`, Q31 for `int32_t`). The coefficients are
+ * normalized by @f$ a_0 @f$ and rounded to @f$ B - 2 @f$ fractional bits,
+ * so they are in @f$ [-2, 2) @f$, which covers all stable second order
+ * sections.
+ *
+ * All five products are summed in an accumulator of twice the width of
+ * @p T (@ref DoubleWidthInt_t), without any intermediate rounding. The sum is
+ * rounded to the output format only once, and then saturated to the range of
+ * @p T instead of wrapping around. Intermediate sums may temporarily wrap
+ * around, this is harmless as long as the final sum fits the accumulator,
+ * i.e. as long as the output is less than 2 in absolute value before
+ * saturation.
+ *
+ * With @p ErrorFeedback enabled, the accumulator is truncated instead of
+ * rounded, and the truncation error is added to the next accumulator. This
+ * first-order noise shaping moves the quantization noise away from DC, which
+ * significantly improves the accuracy of low-pass filters with a low cut-off
+ * frequency, where the poles are close to @f$ z = 1 @f$.
+ *
+ * @tparam  T
+ *          The signed integer type of the signals and coefficients, `int16_t`
+ *          (Q15) or `int32_t` (Q31). `int8_t` (Q7) is supported as well.
+ * @tparam  ErrorFeedback
+ *          Enable first-order error feedback.
+ */
+template <class T = int16_t, bool ErrorFeedback = false>
+class FixedPointBiQuad {
+    static_assert(std::is_integral<T>::value && std::is_signed<T>::value,
+                  "FixedPointBiQuad requires a signed integer type");
+
+  public:
+    /// The double-width type of the accumulator.
+    using acc_t = DoubleWidthInt_t<T>;
+    /// The number of fractional bits of the coefficients.
+    constexpr static uint8_t coefficient_bits =
+        std::numeric_limits<T>::digits - 1;
+
+    FixedPointBiQuad() = default;
+
+    /**
+     * @brief   Construct a new Fixed Point BiQuad object.
+     *
+     * @param   coefficients
+     *          The (floating point) coefficients of the transfer function,
+     *          e.g. a section of @ref butter_coeff. Coefficients that are
+     *          out of range after normalization are saturated.
+     */
+    template <class U>
+    FixedPointBiQuad(const BiQuadCoefficients<U> &coefficients) {
+        const double a0 = double(coefficients.a[0]);
+        for (uint8_t i = 0; i < 3; ++i)
+            b[i] = quantize(double(coefficients.b[i]) / a0);
+        for (uint8_t i = 0; i < 2; ++i)
+            a[i] = quantize(double(coefficients.a[i + 1]) / a0);
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$, as a raw fixed-point integer.
+     * @return  The new output @f$ y[n] @f$, as a raw fixed-point integer.
+     */
+    T operator()(T input) {
+        // Two's complement arithmetic using unsigned integers, so that
+        // intermediate wrap-around is well-defined.
+        uacc_t acc = uacc_t(acc_t(b[0]) * input);
+        acc += uacc_t(acc_t(b[1]) * x[0]);
+        acc += uacc_t(acc_t(b[2]) * x[1]);
+        acc -= uacc_t(acc_t(a[0]) * y[0]);
+        acc -= uacc_t(acc_t(a[1]) * y[1]);
+        if (ErrorFeedback)
+            acc += uacc_t(error);
+        else
+            acc += uacc_t(1) << (coefficient_bits - 1); // round to nearest
+        const acc_t sum = acc_t(acc);
+        const acc_t shifted = sum >> coefficient_bits; // floor
+        if (ErrorFeedback)
+            error = acc_t(sum - acc_t(uacc_t(shifted) << coefficient_bits));
+        const T output = saturate(shifted);
+        x[1] = x[0];
+        x[0] = input;
+        y[1] = y[0];
+        y[0] = output;
+        return output;
+    }
+
+    /**
+     * @brief   Replace the coefficients, without resetting the state of the
+     *          filter.
+     */
+    template <class U>
+    void setCoefficients(const BiQuadCoefficients<U> &coefficients) {
+        const FixedPointBiQuad f{coefficients};
+        b = f.b, a = f.a;
+    }
+
+  private:
+    using uacc_t = typename std::make_unsigned<acc_t>::type;
+    static_assert(((-97 * 2) >> 1) == -97,
+                  "Negative signed right shift incorrect");
+
+    static T saturate(acc_t v) {
+        constexpr acc_t max = std::numeric_limits<T>::max();
+        constexpr acc_t min = std::numeric_limits<T>::min();
+        return T(v > max ? max : v < min ? min : v);
+    }
+
+    static T quantize(double c) {
+        double scaled = std::round(c * double(acc_t(1) << coefficient_bits));
+        constexpr double max = std::numeric_limits<T>::max();
+        constexpr double min = std::numeric_limits<T>::min();
+        return T(scaled > max ? max : scaled < min ? min : scaled);
+    }
+
+  private:
+    AH::Array<T, 2> x = {{}}; ///< Previous inputs
+    AH::Array<T, 2> y = {{}}; ///< Previous outputs
+    AH::Array<T, 3> b = {{}}; ///< Numerator coefficients
+    AH::Array<T, 2> a = {{}}; ///< Denominator coefficients a₁, a₂
+    acc_t error = 0;          ///< Truncation error of the previous output
+};
+
+/// @}
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Second Order Sections filter for Q15 or Q31 fixed-point signals,
+ *          using @ref FixedPointBiQuad for each section.
+ *
+ * This allows the floating point designs of @ref butter_coeff to run on
+ * microcontrollers without a floating point unit, using only integer
+ * arithmetic:
+ *
+ * ~~~cpp
+ * FixedPointSOSFilter<int16_t, 2> filter = butter_coeff<4, double>(0.1);
+ * int16_t y = filter(x); // x and y in Q15 format
+ * ~~~
+ *
+ * Every section saturates its output, so keep the peak gain of the
+ * intermediate sections in mind when choosing the input level.
+ *
+ * @tparam  T
+ *          The signed integer type of the signals, `int16_t` (Q15) or
+ *          `int32_t` (Q31).
+ * @tparam  N
+ *          The number of sections.
+ * @tparam  ErrorFeedback
+ *          Enable first-order error feedback in all sections.
+ */
+template <class T, size_t N, bool ErrorFeedback = false>
+class FixedPointSOSFilter {
+  public:
+    /// Constructor.
+    template <class U>
+    FixedPointSOSFilter(const SOSCoefficients<U, N> &sectionCoefficients) {
+        for (size_t s = 0; s < N; ++s)
+            sections[s] = sectionCoefficients[s];
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$, as a raw fixed-point integer.
+     * @return  The new output @f$ y[n] @f$, as a raw fixed-point integer.
+     */
+    T operator()(T input) {
+        for (auto &section : sections)
+            input = section(input);
+        return input;
+    }
+
+    /// Replace the coefficients of all sections, without resetting the state
+    /// of the filter.
+    template <class U>
+    void setCoefficients(const SOSCoefficients<U, N> &sectionCoefficients) {
+        for (size_t s = 0; s < N; ++s)
+            sections[s].setCoefficients(sectionCoefficients[s]);
+    }
+
+  private:
+    AH::Array<FixedPointBiQuad<T, ErrorFeedback>, N> sections;
+};
+
+/// @}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <AH/STL/algorithm> // std::lower_bound, std::copy
+#include <AH/STL/array>     // std::array
+#include <AH/STL/cstdint>   // uint8_t
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Hampel filter, removes isolated outliers (spikes) from a signal
+ *          without smoothing it.
+ *
+ * The filter looks at a window of @p N inputs centered around the input
+ * @f$ x[n-h] @f$, with @f$ h = (N-1)/2 @f$. If that input deviates from the
+ * median @f$ m @f$ of the window by more than @f$ k @f$ times the scaled
+ * median absolute deviation (MAD), it is considered an outlier and replaced
+ * by the median. Otherwise, it is passed through unchanged, so edges and
+ * other features wider than @f$ h @f$ samples are preserved:
+ *
+ * @f[
+ * y[n] = \begin{cases}
+ *     m & \text{if } |x[n-h] - m| > k \cdot 1.4826 \cdot
+ *         \text{median}\big(|x[n-i] - m|\big) \\
+ *     x[n-h] & \text{otherwise}
+ * \end{cases}
+ * @f]
+ *
+ * The factor 1.4826 makes the MAD an estimate of the standard deviation for
+ * normally distributed inputs, so @f$ k = 3 @f$ is the usual three-sigma
+ * rule. Note that the output is delayed by @f$ h @f$ samples.
+ *
+ * The window is kept sorted between samples: a new input replaces the oldest
+ * one using a binary search and a shift of the inputs in between, which is
+ * cheap because no comparisons are needed for the shift. The median is then
+ * the center element, and the distances to the median are two sorted
+ * sequences (to the left and to the right of the center), so the MAD is
+ * found with a binary search as well, in @f$ O(\log N) @f$, without copying
+ * the window or computing all distances. This is much faster than computing
+ * the median and the MAD from scratch using two @ref MedianFilter "median
+ * filters" (see `bench-HampelFilter`).
+ *
+ * @tparam  N
+ *          The length of the window, must be odd.
+ * @tparam  T
+ *          The type of the input and output values of the filter.
+ */
+template <uint8_t N, class T = float>
+class HampelFilter {
+    static_assert(N % 2 == 1, "Window length must be odd");
+
+  public:
+    /// The type used to compare the deviation to the threshold.
+    using real_t = decltype(T() * 1.f);
+
+    /**
+     * @brief   Construct a new Hampel Filter (zero initialized).
+     *
+     * @param   k
+     *          The threshold, in (estimated) standard deviations.
+     */
+    explicit HampelFilter(real_t k = 3) : HampelFilter(k, T{}) {}
+
+    /**
+     * @brief   Construct a new Hampel Filter, and initialize it with the given
+     *          value.
+     *
+     * @param   k
+     *          The threshold, in (estimated) standard deviations.
+     * @param   initialValue
+     *          Determines the initial state of the filter:
+     *          @f$ x[-N] =\ \ldots\ = x[-2] = x[-1] = \text{initialValue} @f$
+     */
+    HampelFilter(real_t k, T initialValue) {
+        setThreshold(k);
+        previousInputs.fill(initialValue);
+        sorted.fill(initialValue);
+    }
+
+    /// Set the threshold @f$ k @f$, in (estimated) standard deviations.
+    void setThreshold(real_t k) { threshold = k * real_t(1.4826); }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   x
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$, i.e. the input @f$ x[n-h] @f$,
+     *          or the median of the window if it is an outlier.
+     */
+    T operator()(T x) {
+        // Replace the oldest input in the ring buffer and in the sorted window.
+        T old = previousInputs[index];
+        previousInputs[index] = x;
+        if (++index == N)
+            index = 0;
+        replace(old, x);
+
+        T center = previousInputs[index >= h + 1 ? index - h - 1
+                                                 : index + N - h - 1];
+        T median = sorted[h];
+        T deviation = center < median ? median - center : center - median;
+        outlier = real_t(deviation) > threshold * real_t(mad());
+        return outlier ? median : center;
+    }
+
+    /// Check whether the last output was an outlier that was replaced by the
+    /// median.
+    bool isOutlier() const { return outlier; }
+
+  private:
+    /// Move @p x into the sorted window, in place of (a copy of) @p old.
+    void replace(T old, T x) {
+        if (N == 1) {
+            sorted[0] = x;
+            return;
+        }
+        auto first = sorted.begin(), last = sorted.end();
+        auto p = std::lower_bound(first, last, old);
+        if (old < x) {
+            // The inputs between old and x move one place to the left.
+            auto q = std::lower_bound(p + 1, last, x);
+            std::copy(p + 1, q, p);
+            q[-1] = x;
+        } else {
+            // The inputs between x and old move one place to the right.
+            auto q = std::upper_bound(first, p, x);
+            std::copy_backward(q, p, p + 1);
+            *q = x;
+        }
+    }
+
+    /**
+     * @brief   Compute the median absolute deviation of the sorted window.
+     *
+     * The distances from the median to the inputs on its left,
+     * @f$ L_i = m - s_{h-i} @f$ for @f$ 0 \le i \le h @f$, and on its right,
+     * @f$ R_j = s_{h+1+j} - m @f$ for @f$ 0 \le j < h @f$, are both
+     * increasing. The MAD is the element with rank @f$ h @f$ of the two
+     * merged sequences. It is found by a binary search for the number of
+     * elements @f$ i @f$ to take from @f$ L @f$ (and @f$ h + 1 - i @f$
+     * from @f$ R @f$) such that all of those are smaller than or equal to
+     * all others.
+     */
+    T mad() const {
+        const T m = sorted[h];
+        auto left = [&](uint8_t i) { return T(m - sorted[h - i]); };
+        auto right = [&](uint8_t j) { return T(sorted[h + 1 + j] - m); };
+        // i in [1, h + 1], since L_0 = 0 is always among the h + 1 smallest.
+        uint8_t lo = 1, hi = h + 1;
+        while (true) {
+            uint8_t i = lo + (hi - lo) / 2;
+            uint8_t j = h + 1 - i;
+            if (i < h + 1 && j > 0 && left(i) < right(j - 1))
+                lo = i + 1; // L_i should be taken instead of R_(j-1)
+            else if (j < h && right(j) < left(i - 1))
+                hi = i - 1; // R_j should be taken instead of L_(i-1)
+            else
+                return j > 0 && left(i - 1) < right(j - 1) ? right(j - 1)
+                                                           : left(i - 1);
+        }
+    }
+
+  private:
+    /// The delay of the output, and the index of the median in the window.
+    constexpr static uint8_t h = (N - 1) / 2;
+
+    /// The last index in the ring buffer.
+    uint8_t index = 0;
+    /// Whether the last output was an outlier.
+    bool outlier = false;
+    /// The threshold k, multiplied by the MAD scale factor.
+    real_t threshold;
+    /// A ring buffer to keep track of the N last inputs.
+    std::array<T, N> previousInputs;
+    /// The N last inputs, in ascending order.
+    std::array<T, N> sorted;
+};
+
+/// @}
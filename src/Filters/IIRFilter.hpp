@@ -2,6 +2,8 @@
 
 #include <AH/Containers/Array.hpp>
 #include <AH/STL/type_traits>
+#include <Filters/DelayLine.hpp>
+#include <Filters/Overflow.hpp>
 #include <Filters/TransferFunction.hpp>
 
 /// @addtogroup FilterImplementations
@@ -22,9 +24,12 @@
  * y[n] = \frac{1}{a_0} \left(\sum_{i=0}^{N_b-1} b_i \cdot x[n-i]
  *                          - \sum_{i=1}^{N_a-1} a_i \cdot y[n-i] \right)
  * @f]
+ * 
+ * @tparam  Overflow
+ *          The overflow policy for integer types, see @ref IIRFilter.
  */
-template <uint8_t NB, uint8_t NA, class T>
-class NonNormalizingIIRFilter {
+template <uint8_t NB, uint8_t NA, class T, class Overflow = OverflowWrap>
+class NonNormalizingIIRFilter : private Overflow {
   public:
     /**
      * @brief   Construct a new Non-Normalizing IIR Filter object.
@@ -73,11 +78,11 @@ class NonNormalizingIIRFilter {
         // Multiply and accumulate the inputs and their respective coefficients.
         T acc = {};
         for (uint8_t i = 0; i < NB; i++)
-            acc += x[i] * b_coeff_shift[i];
+            acc = Overflow::add(acc, Overflow::mul(x[i], b_coeff_shift[i]));
 
         // Multiply and accumulate the inputs and their respective coefficients.
         for (uint8_t i = 0; i < MA; i++)
-            acc -= y[i] * a_coeff_shift[i];
+            acc = Overflow::sub(acc, Overflow::mul(y[i], a_coeff_shift[i]));
 
         // Save the current output
         acc /= a0;
@@ -95,6 +100,13 @@ class NonNormalizingIIRFilter {
         return acc;
     }
 
+    /// @name   Overflow statistics, see @ref OverflowSaturateCount
+    /// @{
+    using Overflow::getOverflowCount;
+    using Overflow::getPeakMagnitude;
+    using Overflow::resetOverflowStatistics;
+    /// @}
+
   private:
     constexpr static uint8_t MA = NA - 1;
     uint8_t index_b = 0, index_a = 0;
@@ -122,9 +134,12 @@ class NonNormalizingIIRFilter {
  * y[n] = \frac{1}{a_0} \left(\sum_{i=0}^{N_b-1} b_i \cdot x[n-i]
  *                          - \sum_{i=1}^{N_a-1} a_i \cdot y[n-i] \right)
  * @f]
+ * 
+ * @tparam  Overflow
+ *          The overflow policy for integer types, see @ref IIRFilter.
  */
-template <uint8_t NB, uint8_t NA, class T>
-class NormalizingIIRFilter {
+template <uint8_t NB, uint8_t NA, class T, class Overflow = OverflowWrap>
+class NormalizingIIRFilter : private Overflow {
   public:
     /**
      * @brief   Construct a new Normalizing IIR Filter object.
@@ -175,11 +190,11 @@ class NormalizingIIRFilter {
         // Multiply and accumulate the inputs and their respective coefficients.
         T acc = {};
         for (uint8_t i = 0; i < NB; i++)
-            acc += x[i] * b_coeff_shift[i];
+            acc = Overflow::add(acc, Overflow::mul(x[i], b_coeff_shift[i]));
 
         // Multiply and accumulate the inputs and their respective coefficients.
         for (uint8_t i = 0; i < MA; i++)
-            acc -= y[i] * a_coeff_shift[i];
+            acc = Overflow::sub(acc, Overflow::mul(y[i], a_coeff_shift[i]));
 
         // Save the current output
         y[index_a] = acc;
@@ -196,6 +211,13 @@ class NormalizingIIRFilter {
         return acc;
     }
 
+    /// @name   Overflow statistics, see @ref OverflowSaturateCount
+    /// @{
+    using Overflow::getOverflowCount;
+    using Overflow::getPeakMagnitude;
+    using Overflow::resetOverflowStatistics;
+    /// @}
+
   private:
     constexpr static uint8_t MA = NA - 1;
     uint8_t index_b = 0, index_a = 0;
@@ -205,15 +227,118 @@ class NormalizingIIRFilter {
     AH::Array<T, 2 * MA - 1> a_coefficients;
 };
 
+/** 
+ * @brief   Variant of @ref NonNormalizingIIRFilter that stores every 
+ *          coefficient only once.
+ * 
+ * Uses a @ref DelayLine for the previous inputs and outputs, which requires
+ * @f$ N_b + N_a - 1 @f$ fewer coefficients than @ref NonNormalizingIIRFilter.
+ * For integer types, the results are identical.
+ */
+template <uint8_t NB, uint8_t NA, class T>
+class CompactNonNormalizingIIRFilter {
+  public:
+    /// @copydoc NonNormalizingIIRFilter::NonNormalizingIIRFilter(const AH::Array<T, NB> &, const AH::Array<T, NA> &)
+    CompactNonNormalizingIIRFilter(const AH::Array<T, NB> &b_coefficients,
+                                   const AH::Array<T, NA> &a_coefficients)
+        : a0(a_coefficients[0]) {
+        for (uint8_t i = 0; i < NB; ++i)
+            this->b_coefficients[i] = b_coefficients[NB - 1 - i];
+        for (uint8_t i = 0; i < MA; ++i)
+            this->a_coefficients[i] = a_coefficients[MA - i];
+    }
+
+    CompactNonNormalizingIIRFilter(const TransferFunction<NB, NA, T> &tf)
+        : CompactNonNormalizingIIRFilter{tf.b, tf.a} {}
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     * 
+     * @param   input 
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        x.push(input);
+        T acc = x.mac(b_coefficients.begin());
+        acc -= y.mac(a_coefficients.begin());
+        acc /= a0;
+        y.push(acc);
+        return acc;
+    }
+
+  private:
+    constexpr static uint8_t MA = NA - 1;
+    DelayLine<NB, T> x = {};         ///< Previous inputs
+    DelayLine<MA, T> y = {};         ///< Previous outputs
+    AH::Array<T, NB> b_coefficients; ///< Reversed numerator coefficients
+    AH::Array<T, MA> a_coefficients; ///< Reversed denominator coefficients
+    T a0;
+};
+
+/** 
+ * @brief   Variant of @ref NormalizingIIRFilter that stores every coefficient
+ *          only once.
+ * 
+ * Uses a @ref DelayLine for the previous inputs and outputs, which requires
+ * @f$ N_b + N_a - 1 @f$ fewer coefficients than @ref NormalizingIIRFilter.
+ */
+template <uint8_t NB, uint8_t NA, class T>
+class CompactNormalizingIIRFilter {
+  public:
+    /// @copydoc NormalizingIIRFilter::NormalizingIIRFilter(const AH::Array<T, NB> &, const AH::Array<T, NA> &)
+    CompactNormalizingIIRFilter(const AH::Array<T, NB> &b_coefficients,
+                                const AH::Array<T, NA> &a_coefficients) {
+        T a0 = a_coefficients[0];
+        for (uint8_t i = 0; i < NB; ++i)
+            this->b_coefficients[i] = b_coefficients[NB - 1 - i] / a0;
+        for (uint8_t i = 0; i < MA; ++i)
+            this->a_coefficients[i] = a_coefficients[MA - i] / a0;
+    }
+
+    CompactNormalizingIIRFilter(const TransferFunction<NB, NA, T> &tf)
+        : CompactNormalizingIIRFilter{tf.b, tf.a} {}
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     * 
+     * @param   input 
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        x.push(input);
+        T acc = x.mac(b_coefficients.begin());
+        acc -= y.mac(a_coefficients.begin());
+        y.push(acc);
+        return acc;
+    }
+
+  private:
+    constexpr static uint8_t MA = NA - 1;
+    DelayLine<NB, T> x = {};
+    DelayLine<MA, T> y = {};
+    AH::Array<T, NB> b_coefficients;
+    AH::Array<T, MA> a_coefficients;
+};
+
 /// @}
 
 /// Select the @ref NormalizingIIRFilter implementation if @p T is a floating
 /// point type, @ref NonNormalizingIIRFilter otherwise.
-template <uint8_t NB, uint8_t NA, class T>
-using IIRImplementation =
-    typename std::conditional<std::is_floating_point<T>::value,
-                              NormalizingIIRFilter<NB, NA, T>,
-                              NonNormalizingIIRFilter<NB, NA, T>>::type;
+template <uint8_t NB, uint8_t NA, class T, class Overflow = OverflowWrap>
+using IIRImplementation = typename std::conditional<
+    std::is_floating_point<T>::value, NormalizingIIRFilter<NB, NA, T, Overflow>,
+    NonNormalizingIIRFilter<NB, NA, T, Overflow>>::type;
+
+/// Select the @ref CompactNormalizingIIRFilter implementation if @p T is a 
+/// floating point type, @ref CompactNonNormalizingIIRFilter otherwise.
+template <uint8_t NB, uint8_t NA = NB, class T = float>
+using CompactIIRFilter = typename std::conditional<
+    std::is_floating_point<T>::value, CompactNormalizingIIRFilter<NB, NA, T>,
+    CompactNonNormalizingIIRFilter<NB, NA, T>>::type;
 
 /// @addtogroup Filters
 /// @{
@@ -231,9 +356,18 @@ using IIRImplementation =
  * y[n] = \frac{1}{a_0} \left(\sum_{i=0}^{N_b-1} b_i \cdot x[n-i]
  *                          - \sum_{i=1}^{N_a-1} a_i \cdot y[n-i] \right)
  * @f]
+ * 
+ * For integer types, the @p Overflow policy determines what happens when a
+ * product or a partial sum doesn't fit in @p T: @ref OverflowWrap wraps
+ * around (the default, same cost as plain integer arithmetic),
+ * @ref OverflowSaturate clips the result, and @ref OverflowSaturateCount
+ * also counts the overflows and keeps track of the peak magnitude, which can
+ * be read using `filter.getOverflowCount()` and `filter.getPeakMagnitude()`.
+ * Floating point (and @ref FixedPoint) types are not affected.
  */
-template <uint8_t NB, uint8_t NA = NB, class T = float>
-class IIRFilter : public IIRImplementation<NB, NA, T> {
+template <uint8_t NB, uint8_t NA = NB, class T = float,
+          class Overflow = OverflowWrap>
+class IIRFilter : public IIRImplementation<NB, NA, T, Overflow> {
   public:
     /**
      * @brief   Construct a new IIR Filter object.
@@ -253,10 +387,11 @@ class IIRFilter : public IIRImplementation<NB, NA, T> {
      */
     IIRFilter(const AH::Array<T, NB> &b_coefficients,
               const AH::Array<T, NA> &a_coefficients)
-        : IIRImplementation<NB, NA, T>{b_coefficients, a_coefficients} {}
+        : IIRImplementation<NB, NA, T, Overflow>{b_coefficients,
+                                                 a_coefficients} {}
 
     IIRFilter(const TransferFunction<NB, NA, T> &tf)
-        : IIRImplementation<NB, NA, T>{tf} {}
+        : IIRImplementation<NB, NA, T, Overflow>{tf} {}
 
     /**
      * @brief   Update the internal state with the new input @f$ x[n] @f$ and
@@ -267,7 +402,7 @@ class IIRFilter : public IIRImplementation<NB, NA, T> {
      * @return  The new output @f$ y[n] @f$.
      */
     T operator()(T input) {
-        return IIRImplementation<NB, NA, T>::operator()(input);
+        return IIRImplementation<NB, NA, T, Overflow>::operator()(input);
     }
 };
 
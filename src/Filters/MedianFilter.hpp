@@ -102,6 +102,9 @@ class MedianFilter {
  * The output equation is:
  * @f$ y[n] = \text{median}\Big(x[n], x[n-1],\ \ldots,\ x[n-N+1]\Big) @f$
  * 
+ * Every update copies the window and partially sorts it, which is 
+ * @f$ O(N) @f$. For longer windows, @ref SlidingMedianFilter is much faster.
+ * 
  * @tparam  N
  *          The number of previous values to take the median of.
  * @tparam  T 
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <AH/STL/cstdint> // uint8_t
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Moving minimum or maximum filter, the smallest or largest of the
+ *          @p N most recent inputs.
+ *
+ * Use the @ref MovingMin and @ref MovingMax aliases.
+ *
+ * Keeps a monotonic wedge: a double-ended queue with the inputs that can
+ * still become the extremum of a future window. Each input in the queue is
+ * strictly better than all inputs after it, and newer than all inputs before
+ * it, so the current extremum is at the front. A new input removes all inputs
+ * at the back that it dominates, since they leave the window before it does,
+ * and the front is removed when it leaves the window. Every input is added
+ * and removed at most once, so the cost is amortized @f$ O(1) @f$ per sample,
+ * independent of @p N. The queue never holds more than @p N inputs, so the
+ * memory is fixed.
+ *
+ * @tparam  N
+ *          The number of previous values to take the extremum of.
+ * @tparam  T
+ *          The type of the input and output values of the filter.
+ * @tparam  Maximum
+ *          Compute the maximum (true) or the minimum (false).
+ */
+template <uint8_t N, class T, bool Maximum>
+class MovingExtremum {
+    static_assert(N > 0, "Window length must be at least one");
+
+  public:
+    /**
+     * @brief   Construct a new filter (zero initialized).
+     */
+    MovingExtremum() : MovingExtremum(T{}) {}
+
+    /**
+     * @brief   Construct a new filter, and initialize it with the given value.
+     *
+     * @param   initialValue
+     *          Determines the initial state of the filter:
+     *          @f$ x[-N] =\ \ldots\ = x[-2] = x[-1] = \text{initialValue} @f$
+     */
+    MovingExtremum(T initialValue) {
+        // The most recent of the equal initial inputs is the only candidate,
+        // it leaves the window after N - 1 new inputs.
+        values[0] = initialValue;
+        times[0] = uint8_t(-1);
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   x
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T x) {
+        // Remove the front if it is the input x[n - N].
+        if (uint8_t(time - times[front]) >= N) {
+            if (++front == N)
+                front = 0;
+            --size;
+        }
+        // Remove all inputs that can no longer be the extremum, because the
+        // new one is at least as good and stays in the window longer.
+        while (size > 0 && !dominates(values[back()], x))
+            --size;
+        // Wrap in a wider type, front + size can exceed 255.
+        uint16_t i = uint16_t(front) + size++;
+        if (i >= N)
+            i -= N;
+        values[i] = x;
+        times[i] = time++;
+        return values[front];
+    }
+
+    /// Get the extremum of the current window, i.e. the last output.
+    T get() const { return values[front]; }
+
+  private:
+    /// Check whether @p a is a strictly better candidate than @p b.
+    static bool dominates(T a, T b) { return Maximum ? b < a : a < b; }
+
+    /// The index of the back of the wedge in the ring buffers.
+    uint8_t back() const {
+        uint16_t i = uint16_t(front) + size - 1;
+        return i >= N ? i - N : i;
+    }
+
+  private:
+    /// The number of inputs so far, modulo 256, used to time stamp inputs.
+    uint8_t time = 0;
+    /// The index of the front of the wedge in the ring buffers.
+    uint8_t front = 0;
+    /// The number of inputs in the wedge.
+    uint8_t size = 1;
+    /// Ring buffer with the inputs in the wedge.
+    T values[N];
+    /// Ring buffer with the time stamps of the inputs in the wedge.
+    uint8_t times[N];
+};
+
+/**
+ * @brief   Moving minimum filter.
+ *
+ * @f$ y[n] = \min\Big(x[n], x[n-1],\ \ldots,\ x[n-N+1]\Big) @f$
+ *
+ * @see     @ref MovingExtremum
+ */
+template <uint8_t N, class T = float>
+using MovingMin = MovingExtremum<N, T, false>;
+
+/**
+ * @brief   Moving maximum filter, e.g. for peak hold.
+ *
+ * @f$ y[n] = \max\Big(x[n], x[n-1],\ \ldots,\ x[n-N+1]\Big) @f$
+ *
+ * @see     @ref MovingExtremum
+ */
+template <uint8_t N, class T = float>
+using MovingMax = MovingExtremum<N, T, true>;
+
+/**
+ * @brief   Moving range filter, the difference between the largest and the
+ *          smallest of the @p N most recent inputs, e.g. for envelope
+ *          detection.
+ *
+ * @f$ y[n] = \max\Big(x[n],\ \ldots,\ x[n-N+1]\Big) -
+ *            \min\Big(x[n],\ \ldots,\ x[n-N+1]\Big) @f$
+ *
+ * The minimum and maximum themselves are available through
+ * @ref getMinimum() and @ref getMaximum().
+ *
+ * @tparam  N
+ *          The length of the window.
+ * @tparam  T
+ *          The type of the input and output values of the filter.
+ */
+template <uint8_t N, class T = float>
+class MovingRange {
+  public:
+    /**
+     * @brief   Construct a new Moving Range filter (zero initialized).
+     */
+    MovingRange() = default;
+
+    /**
+     * @brief   Construct a new Moving Range filter, and initialize it with
+     *          the given value.
+     *
+     * @param   initialValue
+     *          Determines the initial state of the filter:
+     *          @f$ x[-N] =\ \ldots\ = x[-2] = x[-1] = \text{initialValue} @f$
+     */
+    MovingRange(T initialValue)
+        : minimum(initialValue), maximum(initialValue) {}
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   x
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T x) { return maximum(x) - minimum(x); }
+
+    /// Get the minimum of the current window.
+    T getMinimum() const { return minimum.get(); }
+    /// Get the maximum of the current window.
+    T getMaximum() const { return maximum.get(); }
+
+  private:
+    MovingMin<N, T> minimum;
+    MovingMax<N, T> maximum;
+};
+
+/// @}
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <AH/STL/cstdint>
+#include <AH/STL/limits>
+#include <AH/STL/type_traits>
+
+/// @addtogroup FixedPoint
+/// @{
+
+/**
+ * @brief   Integer arithmetic with explicit behavior on overflow, used to
+ *          implement the overflow policies.
+ *
+ * For types that are not integers (floating point numbers, @ref FixedPoint),
+ * all operations use the normal operators of @p T, and never report an
+ * overflow.
+ */
+template <class T, bool = std::is_integral<T>::value>
+struct OverflowArithmetic {
+    static T wrapAdd(T a, T b) { return a + b; }
+    static T wrapSub(T a, T b) { return a - b; }
+    static T wrapMul(T a, T b) { return a * b; }
+    static T saturateAdd(T a, T b, bool &) { return a + b; }
+    static T saturateSub(T a, T b, bool &) { return a - b; }
+    static T saturateMul(T a, T b, bool &) { return a * b; }
+    template <class U>
+    static T wrapNarrow(U v) {
+        return T(v);
+    }
+    template <class U>
+    static T saturateNarrow(U v, bool &) {
+        return T(v);
+    }
+    static uintmax_t magnitude(T) { return 0; }
+};
+
+template <class T>
+struct OverflowArithmetic<T, true> {
+    constexpr static T max = std::numeric_limits<T>::max();
+    constexpr static T min = std::numeric_limits<T>::min();
+    /// Unsigned type that is not promoted to a signed int.
+    using U = typename std::common_type<typename std::make_unsigned<T>::type,
+                                        unsigned>::type;
+
+    /// @name   Two's complement wrap-around (without undefined behavior)
+    /// @{
+
+    static T wrapAdd(T a, T b) { return T(U(a) + U(b)); }
+    static T wrapSub(T a, T b) { return T(U(a) - U(b)); }
+    static T wrapMul(T a, T b) { return T(U(a) * U(b)); }
+    template <class V>
+    static T wrapNarrow(V v) {
+        return T(v);
+    }
+
+    /// @}
+
+    /// @name   Saturation, sets @p overflow if the result was clipped
+    /// @{
+
+    static T saturateAdd(T a, T b, bool &overflow) {
+        if (b > 0 && a > max - b)
+            return overflow = true, max;
+        if (b < 0 && a < min - b)
+            return overflow = true, min;
+        return T(a + b);
+    }
+    static T saturateSub(T a, T b, bool &overflow) {
+        if (b < 0 && a > max + b)
+            return overflow = true, max;
+        if (b > 0 && a < min + b)
+            return overflow = true, min;
+        return T(a - b);
+    }
+    static T saturateMul(T a, T b, bool &overflow) {
+        if (a == 0 || b == 0)
+            return 0;
+        // The bounds are rounded towards zero by the integer division, which
+        // is exactly what's needed for these strict comparisons.
+        if ((a < 0) != (b < 0)) {
+            if (a > 0 ? b < min / a : a < min / b)
+                return overflow = true, min;
+        } else {
+            if (a > 0 ? a > max / b : a < max / b)
+                return overflow = true, max;
+        }
+        return T(a * b);
+    }
+    template <class V>
+    static T saturateNarrow(V v, bool &overflow) {
+        static_assert(std::is_integral<V>::value, "");
+        if (v > 0 && uintmax_t(v) > uintmax_t(max))
+            return overflow = true, max;
+        if (v < 0 && (min == 0 || intmax_t(v) < intmax_t(min)))
+            return overflow = true, min;
+        return T(v);
+    }
+
+    /// @}
+
+    /// Absolute value, without overflow.
+    static uintmax_t magnitude(T v) {
+        return v < 0 ? uintmax_t(0) - uintmax_t(intmax_t(v)) : uintmax_t(v);
+    }
+};
+
+/**
+ * @brief   Statistics of the policies that don't keep any: the overflow count
+ *          and the peak magnitude are always zero.
+ *
+ * This gives all policies the same interface, so the filters can make the
+ * statistics of their policy available regardless of the policy.
+ */
+struct OverflowNoStatistics {
+    /// Always zero.
+    constexpr uint32_t getOverflowCount() const { return 0; }
+    /// Always zero.
+    constexpr uintmax_t getPeakMagnitude() const { return 0; }
+    /// Does nothing.
+    void resetOverflowStatistics() {}
+};
+
+/**
+ * @brief   Overflow policy that lets integers wrap around on overflow.
+ *
+ * This is the default policy, it has no overhead compared to the normal
+ * integer operators, and it takes up no space (it has no data members, and
+ * the filters inherit from their policy, so the empty base optimization
+ * applies).
+ *
+ * The arithmetic is done using unsigned integers, so the wrap-around is
+ * well-defined: two's complement integers will wrap around from the maximum
+ * to the minimum value and vice versa. Intermediate overflows of a sum cancel
+ * out if the final result is within range.
+ *
+ * @see     @ref OverflowSaturate, @ref OverflowSaturateCount
+ */
+struct OverflowWrap : OverflowNoStatistics {
+    /// Whether this policy saturates results.
+    constexpr static bool saturates = false;
+
+    template <class T>
+    T add(T a, T b) {
+        return OverflowArithmetic<T>::wrapAdd(a, b);
+    }
+    template <class T>
+    T sub(T a, T b) {
+        return OverflowArithmetic<T>::wrapSub(a, b);
+    }
+    template <class T>
+    T mul(T a, T b) {
+        return OverflowArithmetic<T>::wrapMul(a, b);
+    }
+    /// Convert @p v (e.g. a wider accumulator) to type @p T.
+    template <class T, class V>
+    T narrow(V v) {
+        return OverflowArithmetic<T>::wrapNarrow(v);
+    }
+};
+
+/**
+ * @brief   Overflow policy that clips results to the range of the integer
+ *          type instead of wrapping around.
+ *
+ * Every operation that might overflow is checked, which is slower than
+ * @ref OverflowWrap, but the results degrade gracefully: a saturated sine
+ * wave is a clipped sine wave, rather than noise.
+ *
+ * @see     @ref OverflowWrap, @ref OverflowSaturateCount
+ */
+struct OverflowSaturate : OverflowNoStatistics {
+    /// Whether this policy saturates results.
+    constexpr static bool saturates = true;
+
+    template <class T>
+    T add(T a, T b) {
+        bool overflow;
+        return OverflowArithmetic<T>::saturateAdd(a, b, overflow);
+    }
+    template <class T>
+    T sub(T a, T b) {
+        bool overflow;
+        return OverflowArithmetic<T>::saturateSub(a, b, overflow);
+    }
+    template <class T>
+    T mul(T a, T b) {
+        bool overflow;
+        return OverflowArithmetic<T>::saturateMul(a, b, overflow);
+    }
+    /// Convert @p v (e.g. a wider accumulator) to type @p T.
+    template <class T, class V>
+    T narrow(V v) {
+        bool overflow;
+        return OverflowArithmetic<T>::template saturateNarrow<V>(v, overflow);
+    }
+};
+
+/**
+ * @brief   Overflow policy that saturates like @ref OverflowSaturate, and
+ *          keeps statistics to help choosing the integer types.
+ *
+ * Every filter (or every @ref FixedPoint type) with this policy counts how
+ * many operations saturated, and remembers the largest magnitude of all
+ * results. Run it on representative signals: if the overflow count is zero
+ * and the peak magnitude is much smaller than the range of the type, a
+ * smaller type or more fractional bits can be used.
+ *
+ * @see     @ref OverflowWrap, @ref OverflowSaturate
+ */
+class OverflowSaturateCount {
+  public:
+    /// Whether this policy saturates results.
+    constexpr static bool saturates = true;
+
+    template <class T>
+    T add(T a, T b) {
+        bool overflow = false;
+        T result = OverflowArithmetic<T>::saturateAdd(a, b, overflow);
+        return record(result, overflow);
+    }
+    template <class T>
+    T sub(T a, T b) {
+        bool overflow = false;
+        T result = OverflowArithmetic<T>::saturateSub(a, b, overflow);
+        return record(result, overflow);
+    }
+    template <class T>
+    T mul(T a, T b) {
+        bool overflow = false;
+        T result = OverflowArithmetic<T>::saturateMul(a, b, overflow);
+        return record(result, overflow);
+    }
+    /// Convert @p v (e.g. a wider accumulator) to type @p T.
+    template <class T, class V>
+    T narrow(V v) {
+        bool overflow = false;
+        T result =
+            OverflowArithmetic<T>::template saturateNarrow<V>(v, overflow);
+        return record(result, overflow);
+    }
+
+    /// Get the number of operations that overflowed and were saturated.
+    uint32_t getOverflowCount() const { return overflowCount; }
+    /// Get the largest absolute value of all results (after saturation).
+    uintmax_t getPeakMagnitude() const { return peakMagnitude; }
+    /// Reset the overflow count and the peak magnitude to zero.
+    void resetOverflowStatistics() { overflowCount = 0, peakMagnitude = 0; }
+
+  private:
+    template <class T>
+    T record(T result, bool overflow) {
+        overflowCount += overflow;
+        uintmax_t m = OverflowArithmetic<T>::magnitude(result);
+        if (m > peakMagnitude)
+            peakMagnitude = m;
+        return result;
+    }
+
+  private:
+    uint32_t overflowCount = 0;
+    uintmax_t peakMagnitude = 0;
+};
+
+/// @}
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/cmath>
+#include <AH/STL/complex>
+#include <AH/STL/type_traits>
+#include <Filters/DelayLine.hpp>
+#include <Filters/SIMD.hpp>
+#include <Filters/SOSFilter.hpp>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Coefficients of a filter in parallel form: a sum of second order
+ *          sections and a direct FIR term.
+ *
+ * @f[
+ * H(z) = \sum_{k=0}^{S-1} \frac{b_{k,0} + b_{k,1} z^{-1} + b_{k,2} z^{-2}}
+ *                              {a_{k,0} + a_{k,1} z^{-1} + a_{k,2} z^{-2}}
+ *      + \sum_{j=0}^{F-1} d_j z^{-j}
+ * @f]
+ *
+ * @tparam  T
+ *          The type of the coefficients.
+ * @tparam  S
+ *          The number of second order sections.
+ * @tparam  F
+ *          The number of coefficients of the direct FIR term.
+ */
+template <class T, size_t S, size_t F = 1>
+struct ParallelCoefficients {
+    SOSCoefficients<T, S> sections = {{}};
+    AH::Array<T, F> direct = {{}};
+};
+
+/// @}
+
+/// @addtogroup FilterDesign
+/// @{
+
+/**
+ * @brief   Convert a transfer function to parallel form, using a partial
+ *          fraction expansion.
+ *
+ * The poles are the roots of the denominator, computed using the
+ * Durand-Kerner method in double precision. Complex conjugate poles are
+ * combined into a single second order section with real coefficients, real
+ * poles are combined in pairs. If the numerator has at least as many
+ * coefficients as the denominator, the quotient of the polynomial division
+ * is returned as the direct FIR term.
+ *
+ * @note    The partial fraction expansion requires the poles to be distinct.
+ *          Repeated poles (e.g. the transfer function of a cascade of
+ *          identical sections) result in very large residues that cancel
+ *          each other out, and the parallel form will not be accurate.
+ *
+ * @param   tf
+ *          The transfer function to convert. Trailing zeros of the
+ *          denominator are ignored, in that case, the numerator should have
+ *          at least as many trailing zeros, otherwise the direct term doesn't
+ *          fit.
+ * @return  The coefficients of an equivalent parallel filter with
+ *          @f$ \lceil (N_a - 1) / 2 \rceil @f$ sections and
+ *          @f$ \max(N_b - N_a + 1, 1) @f$ direct coefficients.
+ */
+template <size_t NB, size_t NA, class T>
+ParallelCoefficients<T, NA / 2, (NB >= NA ? NB - NA + 1 : 1)>
+tf2parallel(const TransferFunction<NB, NA, T> &tf) {
+    static_assert(NA >= 2, "The denominator should have at least one pole");
+    using complex_t = std::complex<double>;
+    constexpr size_t P = NA - 1; // number of poles
+    constexpr size_t F = NB >= NA ? NB - NA + 1 : 1;
+    ParallelCoefficients<T, NA / 2, F> result;
+
+    // Trailing zeros of the denominator don't add any poles (e.g. the
+    // first order section of an odd order Butterworth filter).
+    size_t n = P;
+    while (n > 0 && tf.a[n] == T(0))
+        --n;
+    size_t nb = NB;
+    while (nb > 0 && tf.b[nb - 1] == T(0))
+        --nb;
+
+    // Polynomial division of the numerator by the denominator (both in z⁻¹):
+    // b = q a + r, with deg r < n.
+    const double a0 = double(tf.a[0]), an = double(tf.a[n]);
+    double r[NB > P ? NB : P] = {};
+    for (size_t i = 0; i < nb; ++i)
+        r[i] = double(tf.b[i]);
+    for (size_t k = nb; k-- > n;) {
+        double q = r[k] / an;
+        if (k - n < F)
+            result.direct[k - n] = T(q);
+        for (size_t j = 0; j <= n; ++j)
+            r[k - n + j] -= q * double(tf.a[j]);
+    }
+
+    // Poles: roots of a₀ zⁿ + a₁ zⁿ⁻¹ + ... + aₙ, using Durand-Kerner.
+    auto denominator = [&](complex_t z) {
+        complex_t p = a0;
+        for (size_t i = 1; i <= n; ++i)
+            p = p * z + double(tf.a[i]);
+        return p;
+    };
+    complex_t poles[P];
+    for (size_t k = 0; k < n; ++k)
+        poles[k] = std::pow(complex_t(0.4, 0.9), double(k));
+    for (unsigned it = 0; it < 1000; ++it) {
+        double change = 0;
+        for (size_t k = 0; k < n; ++k) {
+            complex_t d = a0;
+            for (size_t j = 0; j < n; ++j)
+                if (j != k)
+                    d *= poles[k] - poles[j];
+            complex_t delta = denominator(poles[k]) / d;
+            poles[k] -= delta;
+            change = std::max(change, std::abs(delta));
+        }
+        if (change < 1e-15)
+            break;
+    }
+
+    // Residues: rₖ = r(1/pₖ) / (a₀ ∏ⱼ≠ₖ (1 - pⱼ/pₖ))
+    complex_t residues[P];
+    for (size_t k = 0; k < n; ++k) {
+        complex_t w = 1. / poles[k], num = 0, den = a0;
+        for (size_t i = n; i-- > 0;)
+            num = num * w + r[i];
+        for (size_t j = 0; j < n; ++j)
+            if (j != k)
+                den *= 1. - poles[j] * w;
+        residues[k] = num / den;
+    }
+
+    // Combine conjugate pairs and pairs of real poles into sections.
+    const double tol = 1e-8;
+    size_t s = 0;
+    bool have_real = false;
+    double real_pole = 0, real_residue = 0;
+    for (size_t k = 0; k < n; ++k) {
+        const complex_t p = poles[k], rk = residues[k];
+        if (p.imag() > tol * std::max(1., std::abs(p))) {
+            // r / (1 - p z⁻¹) + r̄ / (1 - p̄ z⁻¹)
+            result.sections[s++] = {
+                {{T(2 * rk.real()), T(-2 * (rk * std::conj(p)).real()), T(0)}},
+                {{T(1), T(-2 * p.real()), T(std::norm(p))}},
+            };
+        } else if (p.imag() >= -tol * std::max(1., std::abs(p))) {
+            if (!have_real) {
+                real_pole = p.real(), real_residue = rk.real();
+                have_real = true;
+                continue;
+            }
+            // r₁ / (1 - p₁ z⁻¹) + r₂ / (1 - p₂ z⁻¹)
+            const double p1 = real_pole, r1 = real_residue;
+            const double p2 = p.real(), r2 = rk.real();
+            result.sections[s++] = {
+                {{T(r1 + r2), T(-(r1 * p2 + r2 * p1)), T(0)}},
+                {{T(1), T(-(p1 + p2)), T(p1 * p2)}},
+            };
+            have_real = false;
+        }
+    }
+    if (have_real)
+        result.sections[s++] = {
+            {{T(real_residue), T(0), T(0)}},
+            {{T(1), T(-real_pole), T(0)}},
+        };
+    // Remaining sections (if there are fewer poles than the length of the
+    // denominator suggests) don't contribute anything.
+    for (; s < NA / 2; ++s)
+        result.sections[s] = {{{T(0), T(0), T(0)}}, {{T(1), T(0), T(0)}}};
+    return result;
+}
+
+/// @}
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Infinite Impulse Response filter in parallel form: a sum of
+ *          independent second order sections and a direct FIR term.
+ *
+ * Implements the following transfer function:
+ *
+ * @f[
+ * H(z) = \sum_{k=0}^{S-1} \frac{b_{k,0} + b_{k,1} z^{-1} + b_{k,2} z^{-2}}
+ *                              {a_{k,0} + a_{k,1} z^{-1} + a_{k,2} z^{-2}}
+ *      + \sum_{j=0}^{F-1} d_j z^{-j}
+ * @f]
+ *
+ * Use @ref tf2parallel to convert a transfer function to parallel form.
+ *
+ * In a cascade (@ref SOSFilter) or direct form (@ref IIRFilter), every
+ * section or coefficient depends on the result of the previous one. Here,
+ * all sections receive the same input, and only their outputs are added
+ * together, so they can be evaluated at the same time, in the lanes of
+ * a @ref SIMDPack. Each section uses the Transposed Direct Form 2.
+ * Parallel form also tends to be less sensitive to rounding of the
+ * coefficients than a high-order direct form.
+ *
+ * @tparam  T
+ *          The floating point type of the signals and coefficients.
+ * @tparam  S
+ *          The number of second order sections.
+ * @tparam  F
+ *          The number of coefficients of the direct FIR term.
+ */
+template <class T, size_t S, size_t F = 1>
+class ParallelIIRFilter {
+    static_assert(std::is_floating_point<T>::value,
+                  "ParallelIIRFilter requires a floating point type");
+
+    using P = SIMDPack<T>;
+
+  public:
+    /// The number of sections that are evaluated at the same time.
+    constexpr static size_t lanes = P::lanes;
+    /// The number of groups of @ref lanes sections.
+    constexpr static size_t groups = (S + lanes - 1) / lanes;
+
+    /// Constructor.
+    ParallelIIRFilter(const ParallelCoefficients<T, S, F> &coefficients) {
+        // Unused lanes of the last group keep all coefficients at zero.
+        for (size_t k = 0; k < S; ++k) {
+            const auto &b = coefficients.sections[k].b;
+            const auto &a = coefficients.sections[k].a;
+            b0[k] = b[0] / a[0];
+            b1[k] = b[1] / a[0];
+            b2[k] = b[2] / a[0];
+            a1[k] = -a[1] / a[0];
+            a2[k] = -a[2] / a[0];
+        }
+        for (size_t j = 0; j < F; ++j)
+            direct[j] = coefficients.direct[F - 1 - j];
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        const P x = P::broadcast(input);
+        P sum = P::zero();
+        T *st1 = state1.begin(), *st2 = state2.begin();
+        for (size_t g = 0; g < G; g += lanes) {
+            P s1 = P::load(st1 + g), s2 = P::load(st2 + g);
+            P y = P::load(b0.begin() + g) * x + s1;
+            s1 = P::load(b1.begin() + g) * x + P::load(a1.begin() + g) * y + s2;
+            s2 = P::load(b2.begin() + g) * x + P::load(a2.begin() + g) * y;
+            s1.store(st1 + g);
+            s2.store(st2 + g);
+            sum += y;
+        }
+        T lanes_sum[lanes];
+        sum.store(lanes_sum);
+        history.push(input);
+        T acc = history.mac(direct.begin());
+        for (size_t l = 0; l < lanes; ++l)
+            acc += lanes_sum[l];
+        return acc;
+    }
+
+  private:
+    constexpr static size_t G = groups * lanes;
+    /// Coefficients of the sections, normalized, denominator negated.
+    AH::Array<T, G> b0 = {{}}, b1 = {{}}, b2 = {{}}, a1 = {{}}, a2 = {{}};
+    /// Transposed Direct Form 2 states of the sections.
+    AH::Array<T, G> state1 = {{}}, state2 = {{}};
+    /// Reversed coefficients of the direct FIR term.
+    AH::Array<T, F> direct;
+    DelayLine<F, T> history;
+};
+
+/// @}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <AH/STL/cstddef>
+#include <AH/STL/cstdint>
+
+/// @addtogroup FilterImplementations
+/// @{
+
+#ifndef FILTERS_NO_SIMD
+#if defined(__AVX__)
+#define FILTERS_SIMD_AVX 1
+#endif
+#if defined(__AVX2__)
+#define FILTERS_SIMD_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FILTERS_SIMD_SSE2 1
+#endif
+#if defined(__SSE4_1__)
+#define FILTERS_SIMD_SSE4_1 1
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FILTERS_SIMD_NEON 1
+#endif
+#endif
+
+#if defined(FILTERS_SIMD_AVX) || defined(FILTERS_SIMD_SSE4_1)
+#include <immintrin.h>
+#elif defined(FILTERS_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(FILTERS_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+/// Number of lanes of the portable @ref SIMDPack fallback. On 8-bit AVR,
+/// there are no vector units, so a single lane is used to keep the stack
+/// usage of the block kernels to a minimum.
+#ifndef FILTERS_SIMD_GENERIC_LANES
+#ifdef __AVR__
+#define FILTERS_SIMD_GENERIC_LANES 1
+#else
+#define FILTERS_SIMD_GENERIC_LANES 8
+#endif
+#endif
+
+/**
+ * @brief   A small pack of values of type @p T that are processed in lockstep.
+ *
+ * This is the portable version, it is just a plain array with element-wise
+ * operations, written in a way that compilers can easily auto-vectorize.
+ * Specializations for `float`, `double` and `int32_t` use SSE, AVX or NEON
+ * intrinsics directly if the target supports them.
+ *
+ * All operations are element-wise and have exactly the same semantics as the
+ * corresponding scalar operations on @p T, so results are bit-identical to
+ * scalar code that performs the same operations in the same order.
+ * Define `FILTERS_NO_SIMD` to disable the intrinsics.
+ *
+ * @tparam  T
+ *          The type of the elements.
+ */
+template <class T, class Enable = void>
+struct SIMDPack {
+    /// The number of elements in one pack.
+    constexpr static size_t lanes = FILTERS_SIMD_GENERIC_LANES;
+
+    /// Load @ref lanes consecutive elements (no alignment requirements).
+    static SIMDPack load(const T *p) {
+        SIMDPack r;
+        for (size_t i = 0; i < lanes; ++i)
+            r.v[i] = p[i];
+        return r;
+    }
+    /// Set all elements to the given value.
+    static SIMDPack broadcast(T t) {
+        SIMDPack r;
+        for (size_t i = 0; i < lanes; ++i)
+            r.v[i] = t;
+        return r;
+    }
+    /// Set all elements to zero.
+    static SIMDPack zero() { return broadcast(T{}); }
+    /// Store @ref lanes consecutive elements (no alignment requirements).
+    void store(T *p) const {
+        for (size_t i = 0; i < lanes; ++i)
+            p[i] = v[i];
+    }
+
+    SIMDPack &operator+=(const SIMDPack &o) {
+        for (size_t i = 0; i < lanes; ++i)
+            v[i] += o.v[i];
+        return *this;
+    }
+    SIMDPack &operator-=(const SIMDPack &o) {
+        for (size_t i = 0; i < lanes; ++i)
+            v[i] -= o.v[i];
+        return *this;
+    }
+    SIMDPack &operator*=(const SIMDPack &o) {
+        for (size_t i = 0; i < lanes; ++i)
+            v[i] *= o.v[i];
+        return *this;
+    }
+
+    T v[lanes];
+};
+
+template <class T, class E>
+SIMDPack<T, E> operator+(SIMDPack<T, E> a, const SIMDPack<T, E> &b) {
+    return a += b;
+}
+template <class T, class E>
+SIMDPack<T, E> operator-(SIMDPack<T, E> a, const SIMDPack<T, E> &b) {
+    return a -= b;
+}
+template <class T, class E>
+SIMDPack<T, E> operator*(SIMDPack<T, E> a, const SIMDPack<T, E> &b) {
+    return a *= b;
+}
+
+/// Specialize @ref SIMDPack for a native vector type.
+#define FILTERS_SIMD_PACK(T, N, V, LOAD, STORE, SET1, ADD, SUB, MUL)           \
+    template <>                                                                \
+    struct SIMDPack<T> {                                                       \
+        constexpr static size_t lanes = N;                                     \
+        static SIMDPack load(const T *p) { return {LOAD(p)}; }                 \
+        static SIMDPack broadcast(T t) { return {SET1(t)}; }                   \
+        static SIMDPack zero() { return broadcast(T{}); }                      \
+        void store(T *p) const { STORE(p, v); }                                \
+        SIMDPack &operator+=(const SIMDPack &o) {                              \
+            v = ADD(v, o.v);                                                   \
+            return *this;                                                      \
+        }                                                                      \
+        SIMDPack &operator-=(const SIMDPack &o) {                              \
+            v = SUB(v, o.v);                                                   \
+            return *this;                                                      \
+        }                                                                      \
+        SIMDPack &operator*=(const SIMDPack &o) {                              \
+            v = MUL(v, o.v);                                                   \
+            return *this;                                                      \
+        }                                                                      \
+        V v;                                                                   \
+    }
+
+#if defined(FILTERS_SIMD_AVX)
+FILTERS_SIMD_PACK(float, 8, __m256, _mm256_loadu_ps, _mm256_storeu_ps,
+                  _mm256_set1_ps, _mm256_add_ps, _mm256_sub_ps, _mm256_mul_ps);
+FILTERS_SIMD_PACK(double, 4, __m256d, _mm256_loadu_pd, _mm256_storeu_pd,
+                  _mm256_set1_pd, _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd);
+#elif defined(FILTERS_SIMD_SSE2)
+FILTERS_SIMD_PACK(float, 4, __m128, _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps,
+                  _mm_add_ps, _mm_sub_ps, _mm_mul_ps);
+FILTERS_SIMD_PACK(double, 2, __m128d, _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                  _mm_add_pd, _mm_sub_pd, _mm_mul_pd);
+#elif defined(FILTERS_SIMD_NEON)
+FILTERS_SIMD_PACK(float, 4, float32x4_t, vld1q_f32, vst1q_f32, vdupq_n_f32,
+                  vaddq_f32, vsubq_f32, vmulq_f32);
+#if defined(__aarch64__)
+FILTERS_SIMD_PACK(double, 2, float64x2_t, vld1q_f64, vst1q_f64, vdupq_n_f64,
+                  vaddq_f64, vsubq_f64, vmulq_f64);
+#endif
+#endif
+
+#if defined(FILTERS_SIMD_AVX2)
+#define FILTERS_SIMD_LOADU_SI256(p) _mm256_loadu_si256((const __m256i *)(p))
+#define FILTERS_SIMD_STOREU_SI256(p, v) _mm256_storeu_si256((__m256i *)(p), v)
+FILTERS_SIMD_PACK(int32_t, 8, __m256i, FILTERS_SIMD_LOADU_SI256,
+                  FILTERS_SIMD_STOREU_SI256, _mm256_set1_epi32,
+                  _mm256_add_epi32, _mm256_sub_epi32, _mm256_mullo_epi32);
+#elif defined(FILTERS_SIMD_SSE4_1)
+#define FILTERS_SIMD_LOADU_SI128(p) _mm_loadu_si128((const __m128i *)(p))
+#define FILTERS_SIMD_STOREU_SI128(p, v) _mm_storeu_si128((__m128i *)(p), v)
+FILTERS_SIMD_PACK(int32_t, 4, __m128i, FILTERS_SIMD_LOADU_SI128,
+                  FILTERS_SIMD_STOREU_SI128, _mm_set1_epi32, _mm_add_epi32,
+                  _mm_sub_epi32, _mm_mullo_epi32);
+#elif defined(FILTERS_SIMD_NEON)
+FILTERS_SIMD_PACK(int32_t, 4, int32x4_t, vld1q_s32, vst1q_s32, vdupq_n_s32,
+                  vaddq_s32, vsubq_s32, vmulq_s32);
+#endif
+
+/// @}
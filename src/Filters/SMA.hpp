@@ -4,7 +4,9 @@
 #include <AH/Math/Divide.hpp>
 #include <AH/STL/algorithm>
 #include <AH/STL/cstdint>
+#include <AH/STL/limits>
 #include <AH/STL/type_traits>
+#include <Filters/Overflow.hpp>
 
 /// @addtogroup Filters
 /// @{
@@ -27,9 +29,16 @@
  * @tparam  sum_t
  *          The type to use for the accumulator, must be large enough to fit
  *          N times the maximum input value.
+ * @tparam  Overflow
+ *          What to do when the sum doesn't fit in @p sum_t:
+ *          @ref OverflowWrap (default), @ref OverflowSaturate or
+ *          @ref OverflowSaturateCount. When saturating, a clipped sum is
+ *          recomputed from the stored inputs on the next update, so the
+ *          filter recovers as soon as the true sum fits again.
  */
-template <uint8_t N, class input_t = uint16_t, class sum_t = uint32_t>
-class SMA {
+template <uint8_t N, class input_t = uint16_t, class sum_t = uint32_t,
+          class Overflow = OverflowWrap>
+class SMA : private Overflow {
   public:
     /** 
      * @brief   Default constructor (initial state is initialized to all zeros).
@@ -57,12 +66,35 @@ class SMA {
      * @return  The new output @f$ y[n] @f$.
      */
     input_t operator()(input_t input) {
-        sum -= previousInputs[index];
-        sum += input;
+        sum_t partial = Overflow::sub(sum, sum_t(previousInputs[index]));
         previousInputs[index] = input;
+        if (Overflow::saturates && (isClipped(sum) || isClipped(partial))) {
+            // The sum might have lost information, start again from scratch.
+            sum = 0;
+            for (input_t x : previousInputs)
+                sum = Overflow::add(sum, sum_t(x));
+        } else {
+            sum = Overflow::add(partial, sum_t(input));
+        }
         if (++index == N)
             index = 0;
-        return AH::round_div<N>(sum);
+        return Overflow::template narrow<input_t>(AH::round_div<N>(sum));
+    }
+
+    /// @name   Overflow statistics, see @ref OverflowSaturateCount
+    /// @{
+    using Overflow::getOverflowCount;
+    using Overflow::getPeakMagnitude;
+    using Overflow::resetOverflowStatistics;
+    /// @}
+
+  private:
+    /// Check whether the given sum is at the limit of its type, i.e. whether
+    /// it might have been saturated.
+    static bool isClipped(sum_t sum) {
+        return sum == std::numeric_limits<sum_t>::max() ||
+               (std::is_signed<sum_t>::value &&
+                sum == std::numeric_limits<sum_t>::lowest());
     }
 
   private:
@@ -39,6 +39,54 @@ class SOSFilter {
         return input;
     }
 
+    /**
+     * @brief   Filter a block of @p n inputs at once.
+     *
+     * Equivalent to calling @ref operator()() for each of the inputs, but
+     * works on a local copy of all sections, so their coefficients and
+     * states don't have to be reloaded from memory for every sample (the
+     * input and output buffers may alias them).
+     *
+     * Each sample still passes through all sections before the next sample
+     * is processed. Running the entire block through one section at a time
+     * turns the cascade into a single long chain of dependent operations,
+     * which was measured to be two to three times slower on a desktop CPU
+     * with hardware FMA, while sample by sample, the sections can be
+     * evaluated in parallel. The `bench-SOSFilter` benchmark compares both.
+     *
+     * @param   in
+     *          Pointer to the @p n inputs.
+     * @param   out
+     *          Pointer to where the @p n outputs should be stored. May be equal
+     *          to @p in.
+     * @param   n
+     *          The number of samples to filter.
+     */
+    void process(const T *in, T *out, size_t n) {
+        AH::Array<Implementation, N> s = sections;
+        for (size_t i = 0; i < n; ++i) {
+            T x = in[i];
+            for (auto &section : s)
+                x = section(x);
+            out[i] = x;
+        }
+        sections = s;
+    }
+
+    /**
+     * @brief   Replace the coefficients of all sections, without resetting the
+     *          state of the filter.
+     *
+     * This allows retuning a running filter without the transient that
+     * results from starting from zero. It is not safe to call this function
+     * while another thread is using the filter, use @ref TunableSOSFilter
+     * for that.
+     */
+    void setCoefficients(const SOSCoefficients<T, N> &sectionCoefficients) {
+        for (size_t s = 0; s < N; ++s)
+            sections[s].setCoefficients(sectionCoefficients[s]);
+    }
+
   private:
     AH::Array<Implementation, N> sections;
 };
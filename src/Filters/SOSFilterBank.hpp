@@ -0,0 +1,192 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/algorithm>
+#include <AH/STL/type_traits>
+#include <Filters/SIMD.hpp>
+#include <Filters/SOSFilter.hpp>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Bank of @p C identical Second Order Sections filters, one for each
+ *          channel of a multi-channel signal.
+ *
+ * The recursion of an IIR filter cannot be vectorized within a single
+ * channel, because every output depends on the previous one. Different
+ * channels are independent, however, so this class runs the same sections on
+ * @ref SIMDPack::lanes channels at a time, in lockstep. Each section uses
+ * the Direct Form 1 difference equation with normalized coefficients:
+ *
+ * @f[
+ * y[n] = \frac{b_0 \cdot x[n] + b_1 \cdot x[n-1] + b_2 \cdot x[n-2]
+ *            - a_1 \cdot y[n-1] - a_2 \cdot y[n-2]}{a_0}
+ * @f]
+ *
+ * The states of the channels are stored per section, in groups of
+ * @ref SIMDPack::lanes channels. If @p C is not a multiple of the number of
+ * lanes, the last group is padded with unused channels.
+ *
+ * Multi-channel signals are passed as frames of @p C samples: one sample for
+ * each channel at the same time step. Use @ref process() to filter many
+ * frames at once, this keeps the state of each section in registers for the
+ * entire block.
+ *
+ * @tparam  T
+ *          The floating point type of the signals and filter coefficients.
+ * @tparam  N
+ *          The number of sections.
+ * @tparam  C
+ *          The number of channels.
+ */
+template <class T, size_t N, size_t C>
+class SOSFilterBank {
+    static_assert(std::is_floating_point<T>::value,
+                  "SOSFilterBank requires a floating point type");
+
+    using P = SIMDPack<T>;
+
+  public:
+    /// The number of channels that are processed in lockstep.
+    constexpr static size_t lanes = P::lanes;
+    /// The number of groups of @ref lanes channels.
+    constexpr static size_t groups = (C + lanes - 1) / lanes;
+
+    /// Constructor.
+    SOSFilterBank(const SOSCoefficients<T, N> &sectionCoefficients) {
+        for (size_t s = 0; s < N; ++s) {
+            const auto &b = sectionCoefficients[s].b;
+            const auto &a = sectionCoefficients[s].a;
+            coefficients[s] = {b[0] / a[0], b[1] / a[0], b[2] / a[0],
+                               -a[1] / a[0], -a[2] / a[0]};
+        }
+    }
+
+    /**
+     * @brief   Update the internal state with a new frame of inputs
+     *          @f$ x_c[n] @f$ and return the new frame of outputs
+     *          @f$ y_c[n] @f$.
+     *
+     * @param   input
+     *          The new inputs @f$ x_c[n] @f$, one for each channel.
+     * @return  The new outputs @f$ y_c[n] @f$, one for each channel.
+     */
+    AH::Array<T, C> operator()(const AH::Array<T, C> &input) {
+        AH::Array<T, C> output;
+        (*this)(input.begin(), output.begin());
+        return output;
+    }
+
+    /**
+     * @brief   Update the internal state with a new frame of inputs
+     *          @f$ x_c[n] @f$ and write the new frame of outputs
+     *          @f$ y_c[n] @f$ to the given buffer.
+     *
+     * @param   input
+     *          Pointer to the @p C new inputs.
+     * @param   output
+     *          Pointer to where the @p C new outputs should be stored. May be
+     *          equal to @p input.
+     */
+    void operator()(const T *input, T *output) { process(input, output, 1); }
+
+    /**
+     * @brief   Filter a block of @p n frames at once.
+     *
+     * Equivalent to calling @ref operator()() for each of the frames, but
+     * processes the entire block one section at a time.
+     *
+     * @param   in
+     *          Pointer to the @p n input frames of @p C samples each.
+     * @param   out
+     *          Pointer to where the @p n output frames should be stored. May be
+     *          equal to @p in.
+     * @param   n
+     *          The number of frames to filter.
+     */
+    void process(const T *in, T *out, size_t n) {
+        // Split into shorter blocks that stay in the cache while they pass
+        // through all sections.
+        while (n > 0) {
+            size_t len = n < block_size ? n : block_size;
+            processBlock(in, out, len);
+            in += len * C;
+            out += len * C;
+            n -= len;
+        }
+    }
+
+    /// The maximum number of frames that @ref process passes through all
+    /// sections at once.
+    constexpr static size_t block_size = 32;
+
+  private:
+    void processBlock(const T *in, T *out, size_t n) {
+        for (size_t g = 0; g < groups; ++g) {
+            const size_t c = g * lanes;
+            const size_t m = C - c < lanes ? C - c : lanes;
+            for (size_t s = 0; s < N; ++s) {
+                const Section &k = coefficients[s];
+                const P b0 = P::broadcast(k.b0), b1 = P::broadcast(k.b1),
+                        b2 = P::broadcast(k.b2), a1 = P::broadcast(k.a1),
+                        a2 = P::broadcast(k.a2);
+                T *st = &state[(g * N + s) * 4 * lanes];
+                P x1 = P::load(st + 0 * lanes), x2 = P::load(st + 1 * lanes);
+                P y1 = P::load(st + 2 * lanes), y2 = P::load(st + 3 * lanes);
+                // The first section reads the inputs, the others filter the
+                // outputs of the previous section in place.
+                const T *src = s == 0 ? in : out;
+                for (size_t i = 0; i < n; ++i) {
+                    P x = load(src + i * C + c, m);
+                    P acc = x * b0;
+                    acc = x1 * b1 + acc;
+                    acc = x2 * b2 + acc;
+                    acc = y1 * a1 + acc;
+                    acc = y2 * a2 + acc;
+                    x2 = x1;
+                    x1 = x;
+                    y2 = y1;
+                    y1 = acc;
+                    store(out + i * C + c, acc, m);
+                }
+                x1.store(st + 0 * lanes);
+                x2.store(st + 1 * lanes);
+                y1.store(st + 2 * lanes);
+                y2.store(st + 3 * lanes);
+            }
+        }
+    }
+
+    /// Load the samples of the @p m channels starting at @p p. The other lanes
+    /// are set to zero.
+    static P load(const T *p, size_t m) {
+        if (m == lanes)
+            return P::load(p);
+        T tmp[lanes] = {};
+        std::copy(p, p + m, tmp);
+        return P::load(tmp);
+    }
+    /// Store the first @p m lanes of @p v to @p p.
+    static void store(T *p, P v, size_t m) {
+        if (m == lanes)
+            return v.store(p);
+        T tmp[lanes];
+        v.store(tmp);
+        std::copy(tmp, tmp + m, p);
+    }
+
+  private:
+    /// Normalized coefficients of a single section, with the signs of the
+    /// denominator coefficients flipped.
+    struct Section {
+        T b0, b1, b2, a1, a2;
+    };
+    AH::Array<Section, N> coefficients;
+    /// For every group and section: the previous inputs @f$ x[n-1] @f$,
+    /// @f$ x[n-2] @f$ and outputs @f$ y[n-1] @f$, @f$ y[n-2] @f$ of each
+    /// channel in the group.
+    AH::Array<T, groups * N * 4 * lanes> state = {{}};
+};
+
+/// @}
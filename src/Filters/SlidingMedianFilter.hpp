@@ -0,0 +1,174 @@
+#pragma once
+
+#include <AH/STL/algorithm> // std::swap
+#include <AH/STL/array>     // std::array
+#include <AH/STL/cstdint>   // uint8_t, uint16_t
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Median filter that keeps the window partially sorted between
+ *          samples, so each update costs @f$ O(\log N) @f$ instead of
+ *          @f$ O(N) @f$.
+ *
+ * Drop-in replacement for @ref MedianFilter, with the same interface and the
+ * same output (including the average of the two center elements for even
+ * @p N).
+ *
+ * The window is split into two heaps: a max-heap with the smallest
+ * @f$ \lceil N/2 \rceil @f$ inputs and a min-heap with the largest
+ * @f$ \lfloor N/2 \rfloor @f$ inputs, so the median is at the root of one or
+ * both heaps. The inputs themselves stay in a ring buffer, and each input
+ * knows its position in the heaps. A new input overwrites the oldest one in
+ * place, after which it is sifted up or down its heap, swapping it with the
+ * root of the other heap first if it crosses the median. No copy of the
+ * window is made.
+ *
+ * On a desktop CPU with random inputs, this filter is already 1.5 times
+ * faster than @ref MedianFilter for @f$ N = 3 @f$, and more than 10 times
+ * faster for @f$ N = 101 @f$. On small microcontrollers, the bookkeeping is
+ * relatively more expensive, so the crossover may be at a larger @p N. Run
+ * `bench-MedianFilter` to compare both for a given target and type.
+ * The extra memory is @f$ 2N @f$ bytes for the heap indices.
+ *
+ * @tparam  N
+ *          The number of previous values to take the median of.
+ * @tparam  T
+ *          The type of the input and output values of the filter.
+ */
+template <uint8_t N, class T = float>
+class SlidingMedianFilter {
+    static_assert(N > 0, "Window length must be at least one");
+
+  public:
+    /**
+     * @brief   Construct a new Sliding Median Filter (zero initialized).
+     */
+    SlidingMedianFilter() : SlidingMedianFilter(T{}) {}
+
+    /**
+     * @brief   Construct a new Sliding Median Filter, and initialize it with
+     *          the given value.
+     *
+     * @param   initialValue
+     *          Determines the initial state of the filter:
+     *          @f$ x[-N] =\ \ldots\ = x[-2] = x[-1] = \text{initialValue} @f$
+     */
+    SlidingMedianFilter(T initialValue) {
+        // All values are equal, so any order satisfies both heap properties.
+        for (uint8_t i = 0; i < N; ++i) {
+            previousInputs[i] = initialValue;
+            heap[i] = i;
+            position[i] = i;
+        }
+    }
+
+    /**
+     * @brief   Calculate the output @f$ y[n] @f$ for a given input
+     *          @f$ x[n] @f$.
+     *
+     * @f$ y[n] = \text{median}\Big(x[n], x[n-1],\ \ldots,\ x[n-N+1]\Big) @f$
+     *
+     * @param   x
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T x) {
+        // Overwrite the oldest input in the ring buffer, its node in the heaps
+        // is reused for the new input.
+        const uint8_t slot = index;
+        if (++index == N)
+            index = 0;
+        previousInputs[slot] = x;
+        const uint8_t i = position[slot];
+
+        // If the new input belongs in the other heap, exchange it with the
+        // root of that heap. The old root moves to the vacated node, and all
+        // elements of the low heap are still less than or equal to all
+        // elements of the high heap.
+        if (i < low_size) {
+            if (high_size > 0 && value(low_size) < x) {
+                swapNodes(i, low_size);
+                siftDown(low_size);
+            }
+        } else {
+            if (x < value(0)) {
+                swapNodes(i, 0);
+                siftDown(0);
+            }
+        }
+        if (siftUp(i) == i)
+            siftDown(i);
+
+        if (N % 2 == 0)
+            return (value(0) + value(low_size)) / 2;
+        else
+            return value(0);
+    }
+
+  private:
+    /// The number of elements in the max-heap, including the median.
+    constexpr static uint8_t low_size = (N + 1) / 2;
+    /// The number of elements in the min-heap.
+    constexpr static uint8_t high_size = N - low_size;
+
+    /// The value of the input at the given node of the heaps.
+    T value(uint8_t node) const { return previousInputs[heap[node]]; }
+
+    /// Check whether node @p a should be closer to the root of its heap than
+    /// node @p b.
+    bool above(uint8_t a, uint8_t b) const {
+        return a < low_size ? value(b) < value(a) : value(a) < value(b);
+    }
+
+    void swapNodes(uint8_t a, uint8_t b) {
+        std::swap(heap[a], heap[b]);
+        position[heap[a]] = a;
+        position[heap[b]] = b;
+    }
+
+    /// Move the element at node @p i up its heap, and return its new node.
+    uint8_t siftUp(uint8_t i) {
+        const uint8_t root = i < low_size ? 0 : low_size;
+        while (i > root) {
+            uint8_t parent = root + (i - root - 1) / 2;
+            if (!above(i, parent))
+                break;
+            swapNodes(i, parent);
+            i = parent;
+        }
+        return i;
+    }
+
+    /// Move the element at node @p i down its heap.
+    void siftDown(uint8_t i) {
+        const uint8_t root = i < low_size ? 0 : low_size;
+        const uint8_t end = i < low_size ? low_size : N;
+        while (true) {
+            uint16_t child = 2 * uint16_t(i - root) + 1 + root;
+            if (child >= end)
+                break;
+            if (child + 1 < end && above(child + 1, child))
+                ++child;
+            if (!above(child, i))
+                break;
+            swapNodes(i, child);
+            i = child;
+        }
+    }
+
+  private:
+    /// The last index in the ring buffer.
+    uint8_t index = 0;
+    /// A ring buffer to keep track of the N last inputs.
+    std::array<T, N> previousInputs;
+    /// The heaps, with indices into @ref previousInputs. Nodes
+    /// [0, low_size) form the max-heap and nodes [low_size, N) the min-heap,
+    /// each with its root at the first node.
+    std::array<uint8_t, N> heap;
+    /// For each element of @ref previousInputs, its node in @ref heap.
+    std::array<uint8_t, N> position;
+};
+
+/// @}
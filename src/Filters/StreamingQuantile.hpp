@@ -0,0 +1,239 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/Error/Error.hpp>
+#include <AH/STL/cstdint>     // uint8_t, uint32_t
+#include <AH/STL/limits>      // std::numeric_limits
+#include <AH/STL/type_traits> // std::is_floating_point
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Estimate one or more quantiles (e.g. the median, the 95th and
+ *          the 99th percentile) of all inputs so far, in constant memory and
+ *          constant time per sample, using the P² algorithm.
+ *
+ * Unlike @ref MedianFilter, which stores the complete window, this filter
+ * only keeps a few markers: for @p M quantiles @f$ p_1 < \ldots < p_M @f$,
+ * it keeps @f$ 2M + 3 @f$ markers at the minimum, at each @f$ p_i @f$,
+ * halfway between each pair of quantiles, and at the maximum. Each marker
+ * stores an estimate of the height (value) of its quantile and its position
+ * (rank) among all inputs so far. When a new input arrives, the positions of
+ * the markers above it are incremented, and markers that drift too far from
+ * their desired position are moved by one, adjusting their height using
+ * a piecewise-parabolic (P²) interpolation between their neighbors.
+ *
+ * This makes it possible to track e.g. percentiles of loop jitter or sensor
+ * noise over hundreds of thousands of samples. The estimate is not exact,
+ * but for smooth distributions, the error is usually well below the spread
+ * of the inputs between neighboring markers. The first @f$ 2M + 3 @f$
+ * outputs are exact. Since all inputs so far are weighted equally, the
+ * estimate adapts slowly when the distribution changes; use
+ * @ref reset() to start over. To prevent the 32-bit count from overflowing,
+ * the count and the marker positions are halved after
+ * @f$ 2^{32} - 1 @f$ inputs, after which the older inputs have half the
+ * weight of the newer ones.
+ *
+ * @see     R. Jain and I. Chlamtac, "The P² algorithm for dynamic calculation
+ *          of quantiles and histograms without storing observations,"
+ *          Communications of the ACM, 28(10), 1985.
+ * @see     K. E. E. Raatikainen, "Simultaneous estimation of several
+ *          percentiles," Simulation, 49(4), 1987.
+ *
+ * @tparam  T
+ *          The floating point type of the inputs and the estimates. The
+ *          desired marker positions are computed in this type as well, so
+ *          use `double` for more than @f$ 2^{24} @f$ inputs.
+ * @tparam  M
+ *          The number of quantiles to estimate.
+ */
+template <class T = float, uint8_t M = 1>
+class StreamingQuantile {
+    static_assert(std::is_floating_point<T>::value,
+                  "StreamingQuantile requires a floating point type");
+    static_assert(M > 0 && M <= 126, "Invalid number of quantiles");
+
+  public:
+    /**
+     * @brief   Construct a new Streaming Quantile estimator for a single
+     *          quantile (only for @p M = 1).
+     *
+     * @param   p
+     *          The quantile to estimate, between 0 and 1 (exclusive), e.g.
+     *          0.5 for the median.
+     *
+     * Unlike the initial value of e.g. @ref MedianFilter, the quantile can't
+     * be passed using `StreamingQuantile<> q = 0.5`, use
+     * `StreamingQuantile<> q(0.5)` instead.
+     */
+    explicit StreamingQuantile(T p = 0.5) : StreamingQuantile(AH::Array<T, M>{{p}}) {
+        static_assert(M == 1, "Use the constructor with an array for M > 1");
+    }
+
+    /**
+     * @brief   Construct a new Streaming Quantile estimator for several
+     *          quantiles.
+     *
+     * @param   p
+     *          The quantiles to estimate, strictly increasing, between 0 and
+     *          1 (exclusive), e.g. {0.5, 0.95, 0.99}. Other values raise an
+     *          @ref ERROR.
+     */
+    StreamingQuantile(const AH::Array<T, M> &p) {
+        increments[0] = 0;
+        for (uint8_t i = 0; i < M; ++i) {
+            T previous = i == 0 ? T(0) : p[i - 1];
+            if (!(previous < p[i] && p[i] < 1))
+                ERROR(F("Quantiles should be strictly increasing and between "
+                        "0 and 1 (exclusive), got ")
+                          << p[i] << F(" at index ") << i,
+                      0x5170);
+            increments[2 * i + 1] = (previous + p[i]) / 2;
+            increments[2 * i + 2] = p[i];
+        }
+        increments[K - 2] = (p[M - 1] + 1) / 2;
+        increments[K - 1] = 1;
+        reset();
+    }
+
+    /// Forget all inputs.
+    void reset() { count = 0; }
+
+    /**
+     * @brief   Update the estimates with the new input @f$ x[n] @f$ and
+     *          return the new estimate of the first quantile @f$ p_1 @f$.
+     *
+     * @param   x
+     *          The new input @f$ x[n] @f$.
+     * @return  The estimate of quantile @f$ p_1 @f$ of
+     *          @f$ x[0], \ldots, x[n] @f$.
+     */
+    T operator()(T x) {
+        if (count < K)
+            insertSorted(x);
+        else
+            update(x);
+        return getQuantile(0);
+    }
+
+    /**
+     * @brief   Get the current estimate of the given quantile.
+     *
+     * @param   i
+     *          The index of the quantile, in the order they were passed to
+     *          the constructor.
+     * @return  The estimate of quantile @f$ p_{i+1} @f$ of all inputs so far,
+     *          or zero if there were no inputs yet.
+     */
+    T getQuantile(uint8_t i) const {
+        if (count >= K)
+            return heights[2 * i + 2];
+        if (count == 0)
+            return 0;
+        // Not enough inputs for the markers yet, the inputs so far are stored
+        // in order, pick the nearest one.
+        return heights[uint8_t(increments[2 * i + 2] * (count - 1) + T(0.5))];
+    }
+
+    /// Get the number of inputs so far (halved whenever it would overflow).
+    uint32_t getCount() const { return count; }
+
+  private:
+    /// Store the first K inputs in ascending order.
+    void insertSorted(T x) {
+        uint8_t i = count++;
+        for (; i > 0 && x < heights[i - 1]; --i)
+            heights[i] = heights[i - 1];
+        heights[i] = x;
+        if (count == K)
+            for (uint8_t j = 0; j < K; ++j)
+                positions[j] = j;
+    }
+
+    void update(T x) {
+        if (count == std::numeric_limits<uint32_t>::max())
+            halve();
+        ++count;
+        // Find the cell that contains x, extending the extreme markers if
+        // necessary, and increment the positions of the markers above it.
+        uint8_t k;
+        if (x < heights[0]) {
+            heights[0] = x;
+            k = 0;
+        } else if (!(x < heights[K - 1])) {
+            heights[K - 1] = x;
+            k = K - 2;
+        } else {
+            k = 0;
+            while (!(x < heights[k + 1]))
+                ++k;
+        }
+        for (uint8_t i = k + 1; i < K; ++i)
+            ++positions[i];
+
+        // Move the inner markers that are at least one position away from
+        // their desired position, if there is room to move. The desired
+        // positions are computed from the count rather than accumulated, to
+        // avoid a drift caused by rounding errors.
+        const T last = T(count - 1);
+        for (uint8_t i = 1; i < K - 1; ++i) {
+            T d = last * increments[i] - T(positions[i]);
+            if ((d >= 1 && positions[i + 1] - positions[i] > 1) ||
+                (d <= -1 && positions[i] - positions[i - 1] > 1)) {
+                int s = d >= 1 ? 1 : -1;
+                T q = parabolic(i, s);
+                if (!(heights[i - 1] < q && q < heights[i + 1]))
+                    q = linear(i, s);
+                heights[i] = q;
+                positions[i] += s;
+            }
+        }
+    }
+
+    /// Halve the positions of the markers and the count, before the count
+    /// overflows. Rounding @f$ (n_i + i) / 2 @f$ down keeps the positions
+    /// strictly increasing, and the first one at zero. It is evaluated in
+    /// two parts, since @f$ n_i + i @f$ itself might overflow.
+    void halve() {
+        for (uint8_t i = 1; i < K; ++i)
+            positions[i] = positions[i] / 2 + (positions[i] % 2 + i) / 2;
+        count = positions[K - 1] + 1;
+    }
+
+    /// Height of marker @p i after moving it by @p s positions, using
+    /// piecewise-parabolic interpolation of its neighbors.
+    T parabolic(uint8_t i, int s) const {
+        T n_prev = T(positions[i - 1]), n = T(positions[i]),
+          n_next = T(positions[i + 1]);
+        T q_prev = heights[i - 1], q = heights[i], q_next = heights[i + 1];
+        return q + s / (n_next - n_prev) *
+                       ((n - n_prev + s) * (q_next - q) / (n_next - n) +
+                        (n_next - n - s) * (q - q_prev) / (n - n_prev));
+    }
+
+    /// Height of marker @p i after moving it by @p s positions, using
+    /// linear interpolation towards its neighbor in that direction.
+    T linear(uint8_t i, int s) const {
+        uint8_t j = i + s;
+        return heights[i] + s * (heights[j] - heights[i]) /
+                                (T(positions[j]) - T(positions[i]));
+    }
+
+  private:
+    /// The number of markers.
+    constexpr static uint8_t K = 2 * M + 3;
+
+    /// The number of inputs so far.
+    uint32_t count;
+    /// The heights of the markers, the estimates of their quantiles. Before
+    /// the first K inputs, the inputs so far in ascending order.
+    T heights[K];
+    /// The actual positions of the markers (zero-based).
+    uint32_t positions[K];
+    /// The quantiles of the markers, i.e. the increments of their desired
+    /// positions for each input.
+    T increments[K];
+};
+
+/// @}
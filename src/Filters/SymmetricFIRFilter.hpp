@@ -0,0 +1,109 @@
+#pragma once
+
+#include <AH/Containers/Array.hpp>
+#include <AH/STL/algorithm>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Linear-phase Finite Impulse Response filter with symmetric or
+ *          antisymmetric coefficients.
+ *
+ * Implements the same difference equation as @ref FIRFilter:
+ *
+ * @f[
+ * y[n] = \sum_{i=0}^{N-1} b_i \cdot x[n-i]
+ * @f]
+ *
+ * but for coefficients that satisfy @f$ b_{N-1-i} = b_i @f$ (symmetric) or
+ * @f$ b_{N-1-i} = -b_i @f$ (antisymmetric). The inputs that share a
+ * coefficient are added (or subtracted) first:
+ *
+ * @f[
+ * y[n] = \sum_{i=0}^{\lfloor N/2 \rfloor - 1} b_i \cdot
+ *        \left(x[n-i] \pm x[n-N+1+i]\right)
+ *        \;\left(+\; b_{(N-1)/2} \cdot x\left[n-\tfrac{N-1}{2}\right]\right)
+ * @f]
+ *
+ * This halves both the number of multiplications and the number of stored
+ * coefficients. The history of inputs is stored twice, so that both ends of
+ * the window are always contiguous in memory, which allows the compiler to
+ * vectorize the loop.
+ *
+ * The four types of linear-phase FIR filters are:
+ *
+ * | Type | Coefficients  | @p N | @p Antisymmetric |
+ * |:----:|:--------------|:-----|:-----------------|
+ * | I    | symmetric     | odd  | false            |
+ * | II   | symmetric     | even | false            |
+ * | III  | antisymmetric | odd  | true             |
+ * | IV   | antisymmetric | even | true             |
+ *
+ * For type III filters, the middle coefficient is always zero.
+ *
+ * @tparam  N
+ *          The total number of coefficients (the length of the impulse
+ *          response).
+ * @tparam  T
+ *          The type of the signals and coefficients.
+ * @tparam  Antisymmetric
+ *          Use antisymmetric instead of symmetric coefficients.
+ */
+template <uint8_t N, class T = float, bool Antisymmetric = false>
+class SymmetricFIRFilter {
+  public:
+    /// The number of coefficients that are stored.
+    constexpr static uint8_t H = (N + 1) / 2;
+
+    /**
+     * @brief   Construct a new Symmetric FIR Filter object.
+     *
+     * @param   coefficients
+     *          The first @f$ \lceil N / 2 \rceil @f$ coefficients
+     *          @f$ b_0, b_1, \ldots @f$ of the transfer function numerator.
+     *          The other coefficients follow from the symmetry. For type III
+     *          filters, the last (middle) coefficient is ignored.
+     */
+    SymmetricFIRFilter(const AH::Array<T, H> &coefficients)
+        : coefficients(coefficients) {}
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        // Every input is stored twice, so the N most recent inputs are always
+        // contiguous, starting at index + 1.
+        buffer[index] = input;
+        buffer[index + N] = input;
+        if (++index == N)
+            index = 0;
+        const T *x = buffer.begin() + index;
+        const T *b = coefficients.begin();
+
+        // x[0] is the oldest input, x[N - 1] the most recent one.
+        T acc = {};
+        for (uint8_t i = 0; i < N / 2; ++i) {
+            if (Antisymmetric)
+                acc += b[i] * (x[N - 1 - i] - x[i]);
+            else
+                acc += b[i] * (x[N - 1 - i] + x[i]);
+        }
+        // Middle coefficient of type I filters.
+        if (N % 2 == 1 && !Antisymmetric)
+            acc += b[H - 1] * x[H - 1];
+        return acc;
+    }
+
+  private:
+    uint8_t index = 0; ///< Index of the oldest input.
+    AH::Array<T, 2 * N> buffer = {{}};
+    AH::Array<T, H> coefficients;
+};
+
+/// @}
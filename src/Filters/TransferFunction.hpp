@@ -18,7 +18,8 @@ struct TransferFunction {
     TransferFunction() = default;
 
     /// Construct a new Transfer Function object.
-    TransferFunction(const AH::Array<T, NB> &b, const AH::Array<T, NA> &a)
+    constexpr TransferFunction(const AH::Array<T, NB> &b,
+                               const AH::Array<T, NA> &a)
         : b(b), a(a) {}
 
     AH::Array<T, NB> b = {{}};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <AH/STL/cstdint>
+
+#ifdef __AVR__
+#error "TripleBuffer requires <atomic>, which is not available on AVR"
+#endif
+
+#include <atomic>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Lock-free exchange of a value between one writer thread and one
+ *          reader thread.
+ *
+ * The writer always has a buffer of its own to write the next value into,
+ * and the reader always has a buffer of its own to read the current value
+ * from. A third buffer holds the most recently published value. Publishing
+ * and picking up a value are each a single atomic exchange of a buffer
+ * index, so neither thread ever waits for the other, and the reader never
+ * sees a partially written value. If the writer publishes several values
+ * before the reader checks for updates, the reader only gets the latest one.
+ *
+ * This is a double buffer (one value being read, one being written) with a
+ * third buffer in between, so the writer never has to wait for the reader to
+ * release the buffer it is reading from.
+ *
+ * @note    This class uses `std::atomic`, so it requires a hosted or ARM
+ *          toolchain. It is not available on AVR.
+ *
+ * @tparam  T
+ *          The type of the values, it is copied as a whole.
+ */
+template <class T>
+class TripleBuffer {
+  public:
+    /// Constructor, all buffers are initialized to @p initial.
+    TripleBuffer(const T &initial = T{})
+        : buffers{initial, initial, initial} {}
+
+    /// @name   Writer thread
+    /// @{
+
+    /// Get the buffer to write the next value into. It is owned by the writer
+    /// until @ref publish() is called.
+    T &writeBuffer() { return buffers[back]; }
+
+    /// Make the contents of the @ref writeBuffer() available to the reader.
+    void publish() {
+        // Release: the reader must see the writes to the buffer. Acquire: the
+        // buffer that is handed back must no longer be read by the reader.
+        uint8_t previous =
+            middle.exchange(back | new_flag, std::memory_order_acq_rel);
+        back = previous & index_mask;
+    }
+
+    /// Copy @p value into the @ref writeBuffer() and publish it.
+    void write(const T &value) {
+        writeBuffer() = value;
+        publish();
+    }
+
+    /// @}
+
+    /// @name   Reader thread
+    /// @{
+
+    /**
+     * @brief   Pick up the latest published value, if there is one.
+     *
+     * When nothing new has been published, this is a single relaxed load.
+     *
+     * @retval  true
+     *          The @ref readBuffer() was replaced by a new value.
+     * @retval  false
+     *          Nothing was published since the previous call, the
+     *          @ref readBuffer() is unchanged.
+     */
+    bool update() {
+        if (!(middle.load(std::memory_order_relaxed) & new_flag))
+            return false;
+        uint8_t previous = middle.exchange(front, std::memory_order_acq_rel);
+        front = previous & index_mask;
+        return true;
+    }
+
+    /// Get the current value. It doesn't change until the next call to
+    /// @ref update().
+    const T &readBuffer() const { return buffers[front]; }
+
+    /// @}
+
+  private:
+    constexpr static uint8_t index_mask = 0x03;
+    constexpr static uint8_t new_flag = 0x04;
+
+    T buffers[3];
+    uint8_t back = 0;               ///< Owned by the writer
+    std::atomic<uint8_t> middle{1}; ///< Shared, index and new flag
+    uint8_t front = 2;              ///< Owned by the reader
+};
+
+/// @}
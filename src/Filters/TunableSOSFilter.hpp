@@ -0,0 +1,100 @@
+#pragma once
+
+#include <Filters/SOSFilter.hpp>
+#include <Filters/TripleBuffer.hpp>
+
+/// @addtogroup Filters
+/// @{
+
+/**
+ * @brief   Second Order Sections filter whose coefficients can be changed by
+ *          another thread while it is running, without locks.
+ *
+ * A control thread (e.g. a user interface) calls @ref setCoefficients, and
+ * the processing thread picks up the new coefficients at the start of the
+ * next call to @ref operator()() or @ref process(). The coefficients are
+ * exchanged through a @ref TripleBuffer, so neither thread ever blocks, and
+ * the filter always runs with a complete set of coefficients, never with a
+ * mix of an old and a new one. The state of the filter is kept, so there is
+ * no transient from restarting at zero.
+ *
+ * Retuning at a high rate is fine: if the control thread updates the
+ * coefficients several times during a single block, the processing thread
+ * only applies the most recent ones. When nothing changed, the overhead is a
+ * single relaxed atomic load per call.
+ *
+ * For a single BiQuad filter, use one section (@p N = 1).
+ *
+ * @note    Like @ref TripleBuffer, this class requires `std::atomic`, so it
+ *          is not available on AVR.
+ *
+ * @tparam  T
+ *          The type of the signals and filter coefficients.
+ * @tparam  N
+ *          The number of sections.
+ * @tparam  Implementation
+ *          The BiQuad implementation to use.
+ */
+template <class T, size_t N, class Implementation = BiQuadFilterDF1<T>>
+class TunableSOSFilter {
+  public:
+    /// Constructor.
+    TunableSOSFilter(const SOSCoefficients<T, N> &sectionCoefficients)
+        : filter(sectionCoefficients), coefficients(sectionCoefficients) {}
+
+    /**
+     * @brief   Set new coefficients for all sections.
+     *
+     * Can be called from a single control thread while another thread is
+     * processing samples. Never blocks.
+     */
+    void setCoefficients(const SOSCoefficients<T, N> &sectionCoefficients) {
+        coefficients.write(sectionCoefficients);
+    }
+
+    /**
+     * @brief   Apply the most recent coefficients passed to
+     *          @ref setCoefficients, if they weren't applied already.
+     *
+     * This is done automatically by @ref operator()() and @ref process().
+     *
+     * @return  Whether new coefficients were applied.
+     */
+    bool applyCoefficients() {
+        if (!coefficients.update())
+            return false;
+        filter.setCoefficients(coefficients.readBuffer());
+        return true;
+    }
+
+    /**
+     * @brief   Update the internal state with the new input @f$ x[n] @f$ and
+     *          return the new output @f$ y[n] @f$.
+     *
+     * @param   input
+     *          The new input @f$ x[n] @f$.
+     * @return  The new output @f$ y[n] @f$.
+     */
+    T operator()(T input) {
+        applyCoefficients();
+        return filter(input);
+    }
+
+    /**
+     * @brief   Filter a block of @p n inputs at once.
+     *
+     * New coefficients are only applied at the start of the block.
+     *
+     * @see     @ref SOSFilter::process
+     */
+    void process(const T *in, T *out, size_t n) {
+        applyCoefficients();
+        filter.process(in, out, n);
+    }
+
+  private:
+    SOSFilter<T, N, Implementation> filter;
+    TripleBuffer<SOSCoefficients<T, N>> coefficients;
+};
+
+/// @}
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <vector>
 
 TEST(EMA, EMA) {
     using namespace std;
@@ -81,3 +82,38 @@ TEST(EMA, EMA_overflow_reset) {
     EXPECT_EQ(ema(maximum), maximum);
     EXPECT_EQ(ema(maximum), maximum);
 }
+
+/// Compare a bank of C channels to C separate scalar EMA instances, using
+/// random inputs over the full supported range, including the extremes.
+template <uint8_t K, uint16_t C, class input_t, class state_t>
+void compareBankToScalar(input_t min, input_t max, input_t initial) {
+    using Bank = EMABank<K, C, input_t, state_t>;
+    using Scalar = EMA<K, input_t, state_t>;
+    ASSERT_TRUE(Bank::supports_range(min, max));
+    Bank bank = initial;
+    std::vector<Scalar> scalar(C, Scalar(initial));
+    std::vector<input_t> frame(C), expected(C);
+    uint32_t seed = C;
+    const uint32_t range = uint32_t(max - min) + 1;
+    for (int n = 0; n < 500; ++n) {
+        for (uint16_t c = 0; c < C; ++c) {
+            seed = seed * 1664525u + 1013904223u;
+            uint32_t r = seed >> 4;
+            frame[c] = n % 100 < 10 ? (r & 1 ? max : min)
+                                    : input_t(min + input_t(r % range));
+            expected[c] = scalar[c](frame[c]);
+        }
+        bank(frame.data(), frame.data()); // in place
+        ASSERT_EQ(frame, expected) << n;
+    }
+}
+
+TEST(EMABank, bitIdenticalToEMA) {
+    compareBankToScalar<2, 12, uint16_t, uint16_t>(0, 1023, 0);
+    compareBankToScalar<6, 64, uint16_t, uint16_t>(0, 1023, 512);
+    compareBankToScalar<6, 70, int16_t, uint32_t>(-32768, 32767, -5);
+    compareBankToScalar<1, 3, int16_t, uint32_t>(-32768, 32767, 100);
+    compareBankToScalar<10, 256, uint16_t, uint32_t>(0, 4095, 0);
+    compareBankToScalar<5, 33, int_fast16_t, uint_fast16_t>(-1024, 1023, 0);
+    compareBankToScalar<0, 17, int32_t, uint32_t>(-1000000, 1000000, 0);
+}
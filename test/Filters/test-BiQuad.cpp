@@ -3,6 +3,8 @@
 #include <Filters/BiQuad.hpp>
 #include <Filters/IIRFilter.hpp>
 
+#include <array>
+
 TEST(BiQuad, BiQuadDF1RandomInt) {
     using namespace std;
     IIRFilter<3, 3, int> reference = {{1, 10, -2}, {-1, 2, -3}};
@@ -49,4 +51,55 @@ TEST(BiQuad, BiQuadDF2RandomFloat) {
     transform(signal.begin(), signal.end(), signal.begin(), biquad);
     transform(expected.begin(), expected.end(), expected.begin(), reference);
     EXPECT_EQ(signal, expected);
-}
\ No newline at end of file
+}
+
+TEST(BiQuad, BiQuadDF2TRandomInt) {
+    using namespace std;
+    IIRFilter<3, 3, int> reference = {{1, 10, -2}, {-1, 2, -3}};
+    BiQuadFilterDF2T<int> biquad = {{1, 10, -2}, {-1, 2, -3}};
+    array<int, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                             100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<int, 20> expected = signal;
+    transform(signal.begin(), signal.end(), signal.begin(), biquad);
+    transform(expected.begin(), expected.end(), expected.begin(), reference);
+    EXPECT_EQ(signal, expected);
+}
+
+TEST(BiQuad, BiQuadDF2TRandomFloat) {
+    using namespace std;
+    IIRFilter<3, 3, float> reference = {{1, 10, -2}, {-1, 2, -3}};
+    BiQuadFilterDF2T<float> biquad = {{1, 10, -2}, {-1, 2, -3}};
+    array<float, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                               100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<float, 20> expected = signal;
+    transform(signal.begin(), signal.end(), signal.begin(), biquad);
+    transform(expected.begin(), expected.end(), expected.begin(), reference);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-5f * std::abs(expected[i]))
+            << i;
+}
+
+TEST(BiQuad, BiQuadDF2TProcess) {
+    using namespace std;
+    BiQuadFilterDF2T<float> biquad = {{0.2, 0.4, 0.2}, {1, -0.5, 0.25}};
+    BiQuadFilterDF2T<float> block = biquad;
+    array<float, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                               100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<float, 20> expected = signal;
+    transform(expected.begin(), expected.end(), expected.begin(), biquad);
+    block.process(signal.data(), signal.data(), 7);
+    block.process(signal.data() + 7, signal.data() + 7, 13);
+    EXPECT_EQ(signal, expected);
+}
+
+TEST(BiQuad, BiQuadDF2TProcessInt) {
+    using namespace std;
+    BiQuadFilterDF2T<int> biquad = {{1, 10, -2}, {-1, 2, -3}};
+    BiQuadFilterDF2T<int> block = biquad;
+    array<int, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                             100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<int, 20> expected = signal;
+    transform(expected.begin(), expected.end(), expected.begin(), biquad);
+    block.process(signal.data(), signal.data(), 20);
+    EXPECT_EQ(signal, expected);
+}
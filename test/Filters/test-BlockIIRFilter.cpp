@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <Filters/BlockIIRFilter.hpp>
+#include <Filters/Butterworth.hpp>
+#include <Filters/IIRFilter.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+/// Filter a random signal using BlockIIRFilter::process and the
+/// sample-by-sample IIRFilter, and return the maximum absolute deviation
+/// relative to the maximum output.
+template <size_t P, size_t K, class T, size_t NB, size_t NA>
+double maxDeviation(const TransferFunction<NB, NA, T> &tf, size_t n = 4096) {
+    BlockIIRFilter<P, K, T> filter = tf;
+    IIRFilter<NB, NA, T> reference = tf;
+    std::vector<T> x(n);
+    int seed = 5;
+    for (auto &xi : x) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        xi = T((seed >> 16) % 2001 - 1000) / T(1000);
+    }
+    std::vector<T> y(n);
+    // Irregular block lengths, so some samples use the scalar recursion.
+    for (size_t i = 0, len = 1; i < n; i += len, len = len * 3 % 101 + 1)
+        filter.process(&x[i], &y[i], std::min(len, n - i));
+    double deviation = 0, peak = 0;
+    for (size_t i = 0; i < n; ++i) {
+        double expected = double(reference(x[i]));
+        deviation = std::max(deviation, std::abs(double(y[i]) - expected));
+        peak = std::max(peak, std::abs(expected));
+    }
+    return deviation / peak;
+}
+
+TEST(BlockIIRFilter, biquadFloat) {
+    auto tf = butter_coeff<2, float>(0.2)[0];
+    double dev8 = maxDeviation<2, 8>(tf);
+    double dev16 = maxDeviation<2, 16>(tf);
+    std::cout << "BiQuad float, K = 8:  " << dev8 << '\n'
+              << "BiQuad float, K = 16: " << dev16 << std::endl;
+    EXPECT_LT(dev8, 1e-5);
+    EXPECT_LT(dev16, 1e-5);
+}
+
+TEST(BlockIIRFilter, biquadLowCutoffFloat) {
+    // Poles close to the unit circle.
+    auto tf = butter_coeff<2, float>(0.01)[0];
+    double dev = maxDeviation<2, 16>(tf);
+    std::cout << "BiQuad float, f_n = 0.01: " << dev << std::endl;
+    EXPECT_LT(dev, 1e-3);
+}
+
+TEST(BlockIIRFilter, sixthOrderDouble) {
+    auto tf = sos2tf(butter_coeff<6, double>(0.3));
+    double dev = maxDeviation<6, 16>(tf);
+    std::cout << "6th order double, K = 16: " << dev << std::endl;
+    EXPECT_LT(dev, 1e-12);
+}
+
+TEST(BlockIIRFilter, numeratorShorterThanDenominator) {
+    TransferFunction<2, 3, double> tf = {{{0.5, 0.25}}, {{2, -0.4, 0.3}}};
+    double dev = maxDeviation<2, 5>(tf);
+    std::cout << "Short numerator double, K = 5: " << dev << std::endl;
+    EXPECT_LT(dev, 1e-13);
+}
+
+TEST(BlockIIRFilter, sampleBySample) {
+    auto tf = butter_coeff<2, double>(0.4)[0];
+    BlockIIRFilter<2, 4, double> filter = tf;
+    IIRFilter<3, 3, double> reference = tf;
+    for (int i = 0; i < 100; ++i) {
+        double x = (i * 7) % 13 - 6;
+        EXPECT_NEAR(filter(x), reference(x), 1e-12) << i;
+    }
+}
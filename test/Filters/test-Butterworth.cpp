@@ -3,6 +3,7 @@
 #include <Filters/Butterworth.hpp>
 #include <Filters/IIRFilter.hpp>
 
+#include <array>
 #include <iomanip>
 
 TEST(Butterworth, evenOrder) {
@@ -147,4 +148,184 @@ TEST(Butterworth, sos2tf) {
     transform(signal.begin(), signal.end(), signal.begin(), butterworth);
     for (size_t i = 0; i < signal.size(); ++i)
         EXPECT_FLOAT_EQ(signal[i], expected[i]) << "at index " << i;
-}
\ No newline at end of file
+}
+
+TEST(Butterworth, constexprMath) {
+    for (int i = -2000; i <= 2000; ++i) {
+        double x = i * 0.00731;
+        EXPECT_NEAR(constexpr_sin(x), std::sin(x), 1e-15) << x;
+        EXPECT_NEAR(constexpr_cos(x), std::cos(x), 1e-15) << x;
+        if (i != 0 && std::abs(std::cos(x)) > 1e-3) {
+            EXPECT_NEAR(constexpr_tan(x) / std::tan(x), 1, 1e-14) << x;
+        }
+    }
+}
+
+/// Butterworth design using the standard (run-time) trigonometric functions.
+template <uint8_t N>
+SOSCoefficients<double, (N + 1) / 2> butter_coeff_runtime(double f_n) {
+    SOSCoefficients<double, (N + 1) / 2> sections;
+    const double gamma = 1 / std::tan(M_PI * f_n / 2);
+    const double gamma2 = gamma * gamma;
+    for (uint8_t k = 0; k < N / 2; ++k) {
+        const double alpha = 2 * std::cos(2 * M_PI * (2 * k + N + 1) / (4 * N));
+        const double a0 = gamma2 - alpha * gamma + 1;
+        sections[k] = {
+            {{1 / a0, 2 / a0, 1 / a0}},
+            {{1, 2 * (1 - gamma2) / a0, (gamma2 + alpha * gamma + 1) / a0}},
+        };
+    }
+    if (N % 2 == 1)
+        sections[N / 2] = {
+            {{1 / (gamma + 1), 1 / (gamma + 1), 0}},
+            {{1, (1 - gamma) / (gamma + 1), 0}},
+        };
+    return sections;
+}
+
+template <uint8_t N, size_t M>
+void expectCoefficientsNear(const SOSCoefficients<double, M> &actual,
+                            const SOSCoefficients<double, M> &expected) {
+    for (size_t s = 0; s < M; ++s)
+        for (size_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(actual[s].b[i], expected[s].b[i], 1e-14)
+                << "N = " << +N << ", section " << s << ", b" << i;
+            EXPECT_NEAR(actual[s].a[i], expected[s].a[i], 1e-13)
+                << "N = " << +N << ", section " << s << ", a" << i;
+        }
+}
+
+TEST(Butterworth, constexprCoefficients) {
+    constexpr auto sos6 = butter_coeff<6, double>(0.1);
+    static_assert(sos6.data[0].a.data[0] == 1, "");
+    expectCoefficientsNear<6>(sos6, butter_coeff_runtime<6>(0.1));
+    constexpr auto sos7 = butter_coeff<7, double>(0.37);
+    expectCoefficientsNear<7>(sos7, butter_coeff_runtime<7>(0.37));
+    constexpr auto sos2 = butter_coeff<2, double>(0.9);
+    expectCoefficientsNear<2>(sos2, butter_coeff_runtime<2>(0.9));
+    constexpr auto sos1 = butter_coeff<1, double>(0.01);
+    expectCoefficientsNear<1>(sos1, butter_coeff_runtime<1>(0.01));
+
+    // Float coefficients can be used directly by a filter.
+    constexpr auto sos6f = butter_coeff<6>(0.1);
+    SOSFilter<float, 3> filter = sos6f;
+    auto reference = butter<6>(0.1);
+    for (int i = 0; i < 20; ++i)
+        EXPECT_EQ(filter(i % 3), reference(i % 3));
+}
+
+TEST(Butterworth, highpass) {
+    using namespace std;
+
+    auto filter = butter_highpass<5, double>(0.3);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        20.188501386988637, -59.03316427216269, 55.090306904028175,
+        -30.039599300476908, 31.772787645200463, -16.692606492415308,
+        3.9114297856535263, -10.467474838602024, 39.72193040929311,
+        -106.59059948386084, 115.62474105850367, -67.74497014677553,
+        29.892378488420697, 8.41704219608381, -6.031070803627641,
+        -11.398750511160248, 11.182073173249883, -55.60822417301706,
+        69.13627243250386, -22.286115097424684,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Butterworth, bandpass) {
+    using namespace std;
+
+    auto filter = butter_bandpass<4, double>(0.2, 0.5);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        1.8563010626897185, 5.45429512061372, 1.2570444165702588,
+        -12.533262244778886, -16.638489580099165, -1.8099932607468823,
+        14.162501514407772, 15.515875926594937, 10.692977486265333,
+        10.559499439659186, 0.7379715955494621, -22.711296264437944,
+        -29.248720023492844, -10.908461921584152, 7.39116279043655,
+        16.93860314842602, 22.50665575244547, 17.42389461482064,
+        -5.864197031779124, -29.41863939858716,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Butterworth, bandpassWide) {
+    using namespace std;
+
+    auto filter = butter_bandpass<3, double>(0.05, 0.9);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        62.13994742262534, 25.73830071490803, 10.642058669376489,
+        28.405863107261567, -44.132702871273985, -14.972715725870009,
+        -66.3522441229655, -64.54628339738923, 37.264675238223596,
+        -42.32351838277647, -8.489141938357548, 61.940216600659824,
+        -59.20476281737049, 24.734041786887552, 5.60955636141723,
+        4.689328426893283, 92.48141623987932, -5.624339978161281,
+        12.88270118538523, -4.83244577082354,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Butterworth, bandstop) {
+    using namespace std;
+
+    auto filter = butter_bandstop<3, double>(0.2, 0.4);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        52.762438250194336, -35.1575259079434, 82.84659626354802,
+        15.181834230884315, 70.86794262978913, 31.34645834836138,
+        41.115010885511396, 11.252546519299349, 87.24744654614346,
+        -113.0905354302414, 95.71432836866116, -58.395966727792626,
+        2.620964871804734, 11.050184854977843, 16.45727295897126,
+        22.263062285217742, 76.40106147453642, -11.464793257303896,
+        105.24039413662933, 26.539299565490573,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Butterworth, bandpassSections) {
+    // A band-pass filter of order 2N needs only N sections.
+    auto sos = butter_bandpass_coeff<5, double>(0.2, 0.3);
+    static_assert(decltype(sos)::length == 5, "");
+    // All sections have a zero at DC and at the Nyquist frequency.
+    for (auto &s : sos) {
+        EXPECT_NEAR(s.b[0] + s.b[1] + s.b[2], 0, 1e-12);
+        EXPECT_NEAR(s.b[0] - s.b[1] + s.b[2], 0, 1e-12);
+    }
+    // Unity gain at the center frequency ω₀ = 2 atan(√(tan(ω₁/2) tan(ω₂/2))).
+    const double w0 =
+        2 * std::atan(std::sqrt(std::tan(M_PI * 0.2 / 2) *
+                                std::tan(M_PI * 0.3 / 2)));
+    const std::complex<double> z = std::polar(1., w0);
+    std::complex<double> h = 1;
+    for (auto &s : sos)
+        h *= (s.b[0] + s.b[1] / z + s.b[2] / z / z) /
+             (s.a[0] + s.a[1] / z + s.a[2] / z / z);
+    EXPECT_NEAR(std::abs(h), 1, 1e-12);
+    // The poles closest to the unit circle are in the last section.
+    for (size_t i = 1; i < sos.length; ++i)
+        EXPECT_LE(sos[i - 1].a[2], sos[i].a[2]);
+}
@@ -1,4 +1,4 @@
-from scipy.signal import lfilter, butter
+from scipy.signal import lfilter, butter, sosfilt
 import numpy as np
 
 type = 'double'
@@ -16,4 +16,20 @@ print(f'array<{type}, {len(signal)}> expected = {{')
 print(' ', ', '.join(map(lambda x: str(x), output)))
 print('};')
 print(f'transform(signal.begin(), signal.end(), signal.begin(), butterworth);')
-print('EXPECT_EQ(signal, expected);')
\ No newline at end of file
+print('EXPECT_EQ(signal, expected);')
+
+# High-pass, band-pass and band-stop transformations
+designs = {
+    'butter_highpass<5, double>(0.3)': butter(5, 0.3, 'highpass', output='sos'),
+    'butter_bandpass<4, double>(0.2, 0.5)':
+        butter(4, [0.2, 0.5], 'bandpass', output='sos'),
+    'butter_bandpass<3, double>(0.05, 0.9)':
+        butter(3, [0.05, 0.9], 'bandpass', output='sos'),
+    'butter_bandstop<3, double>(0.2, 0.4)':
+        butter(3, [0.2, 0.4], 'bandstop', output='sos'),
+}
+for design, sos in designs.items():
+    print(design)
+    print(f'array<double, {len(signal)}> expected = {{')
+    print(' ', ', '.join(map(repr, map(float, sosfilt(sos, signal)))))
+    print('};')
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <Filters/CIC.hpp>
+#include <Filters/FIRFilter.hpp>
+
+#include <cmath>
+#include <vector>
+
+/// Impulse response of a CIC filter: the convolution of @p Stages boxcars of
+/// length @p RM.
+static std::vector<int> cicImpulseResponse(int RM, int Stages) {
+    std::vector<int> h = {1};
+    for (int s = 0; s < Stages; ++s) {
+        std::vector<int> next(h.size() + RM - 1);
+        for (size_t i = 0; i < h.size(); ++i)
+            for (int k = 0; k < RM; ++k)
+                next[i + k] += h[i];
+        h = next;
+    }
+    return h;
+}
+
+static int randomInput(int &seed, int range) {
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+    return (seed >> 8) % (2 * range + 1) - range;
+}
+
+TEST(CICDecimator, compareToFIRFilter) {
+    // Gain (4·2)³ = 512, so inputs of ±60 need 16 bits, the integrators wrap
+    // around all the time.
+    using Decimator = CICDecimator<4, 2, 3, int16_t, uint16_t>;
+    static_assert(Decimator::gain == 512, "");
+    static_assert(Decimator::supports_range(-64, 63), "");
+    static_assert(!Decimator::supports_range(-64, 64), "");
+    static_assert(!Decimator::supports_range(-65, 63), "");
+    Decimator decimator;
+    auto h = cicImpulseResponse(8, 3);
+    ASSERT_EQ(h.size(), 22u);
+    AH::Array<int, 22> b;
+    std::copy(h.begin(), h.end(), b.begin());
+    FIRFilter<22, int> reference = b;
+
+    int seed = 1;
+    unsigned outputs = 0;
+    for (unsigned n = 0; n < 400; ++n) {
+        int x = randomInput(seed, 60);
+        int expected = reference(x);
+        bool ready = decimator.update(int16_t(x));
+        EXPECT_EQ(ready, n % 4 == 3) << n;
+        if (ready) {
+            EXPECT_EQ(decimator.getRawValue(), expected) << n;
+            ++outputs;
+        }
+    }
+    EXPECT_EQ(outputs, 100u);
+}
+
+TEST(CICDecimator, unsignedDC) {
+    CICDecimator<16, 1, 4, uint16_t, uint32_t> decimator;
+    static_assert(decimator.supports_range(0u, 4095u), "");
+    uint16_t block[16];
+    std::fill(std::begin(block), std::end(block), 1000);
+    uint16_t y = 0;
+    for (int i = 0; i < 5; ++i)
+        y = decimator(block);
+    EXPECT_EQ(y, 1000);
+    EXPECT_EQ(decimator.getRawValue(), 1000u * 65536u);
+}
+
+TEST(CICDecimator, rounding) {
+    // Gain of 4, single stage: the output is the rounded mean of 4 inputs.
+    CICDecimator<4, 1, 1, int16_t, uint16_t> decimator;
+    int16_t a[4] = {1, 1, 0, 0};   // 0.5 → 1
+    int16_t b[4] = {-1, -1, 0, 0}; // -0.5 → -1
+    int16_t c[4] = {-1, 0, 0, 0};  // -0.25 → 0
+    int16_t d[4] = {3, 3, 3, 2};   // 2.75 → 3
+    EXPECT_EQ(decimator(a), 1);
+    EXPECT_EQ(decimator(b), -1);
+    EXPECT_EQ(decimator(c), 0);
+    EXPECT_EQ(decimator(d), 3);
+}
+
+TEST(CICInterpolator, compareToFIRFilter) {
+    using Interpolator = CICInterpolator<5, 1, 3, int16_t, uint16_t>;
+    static_assert(Interpolator::gain == 25, "");
+    Interpolator interpolator;
+    auto h = cicImpulseResponse(5, 3);
+    AH::Array<int, 13> b;
+    ASSERT_EQ(h.size(), 13u);
+    std::copy(h.begin(), h.end(), b.begin());
+    FIRFilter<13, int> reference = b;
+
+    int seed = 7;
+    for (unsigned m = 0; m < 100; ++m) {
+        int x = randomInput(seed, 1000);
+        int16_t raw[5];
+        interpolator.updateRaw(int16_t(x), raw);
+        for (int j = 0; j < 5; ++j)
+            EXPECT_EQ(raw[j], reference(j == 0 ? x : 0)) << m << ", " << j;
+    }
+}
+
+TEST(CICInterpolator, linearInterpolation) {
+    // Two stages with M = 1 interpolate linearly between the inputs.
+    CICInterpolator<4, 1, 2, int16_t, uint16_t> interpolator;
+    interpolator(0);
+    auto y = interpolator(400);
+    EXPECT_EQ(y, (AH::Array<int16_t, 4>{{100, 200, 300, 400}}));
+    y = interpolator(-400);
+    EXPECT_EQ(y, (AH::Array<int16_t, 4>{{200, 0, -200, -400}}));
+}
+
+TEST(CICCompensator, flatPassband) {
+    constexpr uint16_t R = 16;
+    constexpr uint8_t M = 1, S = 4;
+    auto h = cic_compensator_coeff<21, double>(R, M, S, 0.6);
+    double sum = 0;
+    for (size_t i = 0; i < h.length; ++i) {
+        EXPECT_NEAR(h[i], h[h.length - 1 - i], 1e-12) << i;
+        sum += h[i];
+    }
+    EXPECT_NEAR(sum, 1, 1e-12);
+    // The CIC droop is 2.3 dB at f_n = 0.4, compensated within 0.2 dB.
+    EXPECT_LT(20 * std::log10(cic_magnitude(R, M, S, 0.4)), -2.2);
+    for (double f = 0; f <= 0.4; f += 0.01) {
+        double re = 0, im = 0;
+        for (size_t i = 0; i < h.length; ++i)
+            re += h[i] * std::cos(M_PI * f * i),
+                im -= h[i] * std::sin(M_PI * f * i);
+        const double total = std::hypot(re, im) * cic_magnitude(R, M, S, f);
+        EXPECT_NEAR(20 * std::log10(total), 0, 0.2) << f;
+    }
+}
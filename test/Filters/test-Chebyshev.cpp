@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <Filters/Chebyshev.hpp>
+
+#include <algorithm>
+#include <array>
+
+TEST(Chebyshev, cheby1EvenOrder) {
+    using namespace std;
+
+    auto filter = cheby1<6, double>(0.3, 1);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        0.048662556296944964, 0.4889592868852729, 2.3779044902492927,
+        7.514801025969944, 17.43833504921124, 31.69642740336493,
+        46.72765983411588, 56.6199641946158, 55.80658197084475,
+        42.42437755984322, 20.350095698137142, -1.8266489229142175,
+        -14.946387538000794, -14.26349832324158, -2.1443735444184298,
+        13.36386378669161, 23.494630747191994, 24.348146953868284,
+        19.425463597515474, 17.025860414616393,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Chebyshev, cheby1OddOrder) {
+    using namespace std;
+
+    auto filter = cheby1<5, double>(0.2, 0.5);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        0.039522800744086865, 0.3528178304155168, 1.557542794218361,
+        4.60764395250593, 10.389857018758136, 19.12955444109606,
+        29.899479217113193, 40.506266858390575, 47.940508923415976,
+        49.42025770568081, 43.64446421697993, 31.562707863539302,
+        16.265750600731746, 2.0112542291312367, -7.299934188215283,
+        -9.514023474632832, -4.794060168571891, 4.850110040048006,
+        16.68282680955902, 28.288134728832063,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Chebyshev, cheby2EvenOrder) {
+    using namespace std;
+
+    auto filter = cheby2<6, double>(0.3, 40);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        2.085194143282702, 5.385940637313445, 12.804212507909625,
+        21.915020285781583, 34.2035566361731, 44.481910399254346,
+        51.37503387493817, 50.21956785685499, 43.24731955375102,
+        27.788815750711034, 12.159241983211583, -3.139674611339336,
+        -9.724748810104654, -9.98647583917359, -1.9944342433168956,
+        9.61564931266684, 22.723226020581482, 32.82741744826556,
+        40.91636105201635, 44.90266979563956,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Chebyshev, cheby2OddOrder) {
+    using namespace std;
+
+    auto filter = cheby2<5, double>(0.4, 50);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        1.3332494959687204, 4.792815480526469, 12.099592257916912,
+        23.322978025931295, 36.578022173169444, 48.788173593918884,
+        55.09196201185894, 52.05248718507213, 40.21666883948068,
+        21.96122360453538, 3.957795626500891, -7.888991657807007,
+        -11.014863887926493, -4.84819374175209, 5.73499652459777,
+        16.37061802720993, 24.680204675423997, 30.106014969328864,
+        35.09021523790278, 41.230007294507566,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Chebyshev, cheby1Highpass) {
+    using namespace std;
+
+    SOSFilter<double, 2> filter =
+        analog_prototype2sos_highpass<double>(cheby1_prototype<4>(1), 0.3);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        20.05475981303321, -56.313890974859525, 49.93086444639819,
+        -25.584014821280086, 26.857066722488547, -12.993126776556846,
+        2.139578050714242, -9.833213377216676, 38.73053321504801,
+        -100.20472732327715, 107.47050203795726, -57.31888062825101,
+        20.012808965083796, 11.188270443451579, -8.094684995219254,
+        -12.088467740948353, 12.72830694445866, -51.38387270882384,
+        64.90795803421906, -17.313423125450022,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Chebyshev, cheby2Bandstop) {
+    using namespace std;
+
+    SOSFilter<double, 4> filter = analog_prototype2sos_bandstop<double>(
+        cheby2_prototype<4>(40), 0.2, 0.5);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        13.533791665221221, -19.617001958247698, 54.65642944282288,
+        -36.70236208376761, 66.946803812626, -1.4645134252153102,
+        41.112558977256256, 28.607337011862256, 56.40142567832831,
+        -19.17584307530103, 119.88796439185904, -74.41982450941873,
+        102.26176371873304, -19.94785672283902, 4.400446699579367,
+        27.71629751344158, 5.751716931165546, -21.500653368057577,
+        68.07003166534024, -35.69083858233899,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
@@ -0,0 +1,30 @@
+from scipy.signal import sosfilt, cheby1, cheby2
+import numpy as np
+
+signal = np.array((100, 10, 102, 23, 51, 1, -10, -53, 100, -100, 100, -10, 10,
+                   11, 20, 30, 123, 12, 90, 10),
+                  dtype=np.float64)
+
+designs = {
+    'cheby1<6, double>(0.3, 1)': cheby1(6, 1, 0.3, output='sos'),
+    'cheby1<5, double>(0.2, 0.5)': cheby1(5, 0.5, 0.2, output='sos'),
+    'cheby2<6, double>(0.3, 40)': cheby2(6, 40, 0.3, output='sos'),
+    'cheby2<5, double>(0.4, 50)': cheby2(5, 50, 0.4, output='sos'),
+}
+for design, sos in designs.items():
+    print(design)
+    print(f'array<double, {len(signal)}> expected = {{')
+    print(' ', ', '.join(map(repr, map(float, sosfilt(sos, signal)))))
+    print('};')
+
+designs = {
+    'analog_prototype2sos_highpass<double>(cheby1_prototype<4>(1), 0.3)':
+        cheby1(4, 1, 0.3, 'highpass', output='sos'),
+    'analog_prototype2sos_bandstop<double>(cheby2_prototype<4>(40), 0.2, 0.5)':
+        cheby2(4, 40, [0.2, 0.5], 'bandstop', output='sos'),
+}
+for design, sos in designs.items():
+    print(design)
+    print(f'array<double, {len(signal)}> expected = {{')
+    print(' ', ', '.join(map(repr, map(float, sosfilt(sos, signal)))))
+    print('};')
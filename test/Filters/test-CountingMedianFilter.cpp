@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <Filters/CountingMedianFilter.hpp>
+#include <Filters/MedianFilter.hpp>
+
+#include <algorithm>
+#include <vector>
+
+/// Generate random inputs that are sometimes spread over the full range, and
+/// sometimes clustered at a few values far apart (with long runs of empty
+/// bins in between).
+static uint16_t randomInput(uint32_t &seed, int n, uint16_t max) {
+    seed = seed * 1664525u + 1013904223u;
+    uint16_t r = seed >> 16;
+    switch (n / 500 % 3) {
+        case 0: return r % (max + 1);
+        case 1: return (r % 3) * (max / 2);
+        default: return max / 3 + r % 5;
+    }
+}
+
+template <uint8_t N, uint8_t Bits>
+void compareToMedianFilter(uint16_t initial) {
+    constexpr uint16_t max = (1u << Bits) - 1;
+    MedianFilter<N, uint16_t> reference = initial;
+    CountingMedianFilter<N, Bits> filter = initial;
+    uint32_t seed = N;
+    for (int n = 0; n < 3000; ++n) {
+        uint16_t x = randomInput(seed, n, max);
+        ASSERT_EQ(filter(x), reference(x)) << "N = " << +N << ", n = " << n;
+    }
+}
+
+TEST(CountingMedianFilter, compareToMedianFilter) {
+    compareToMedianFilter<1, 10>(0);
+    compareToMedianFilter<2, 10>(1023);
+    compareToMedianFilter<3, 4>(7);
+    compareToMedianFilter<6, 10>(0);
+    compareToMedianFilter<31, 12>(2048);
+    compareToMedianFilter<100, 10>(0);
+    compareToMedianFilter<101, 11>(5);
+    compareToMedianFilter<255, 10>(1023);
+}
+
+TEST(CountingMedianFilter, longWindow) {
+    constexpr uint16_t N = 501;
+    CountingMedianFilter<N, 12> filter;
+    std::vector<uint16_t> window(N, 0);
+    uint32_t seed = 42;
+    for (int n = 0; n < 5000; ++n) {
+        uint16_t x = randomInput(seed, n, 4095);
+        window[n % N] = x;
+        std::vector<uint16_t> sorted = window;
+        std::nth_element(sorted.begin(), sorted.begin() + N / 2, sorted.end());
+        ASSERT_EQ(filter(x), sorted[N / 2]) << n;
+    }
+}
+
+TEST(CountingMedianFilter, clamp) {
+    CountingMedianFilter<3, 10> filter = 2000;
+    EXPECT_EQ(filter(5000), 1023);
+    EXPECT_EQ(filter(0), 1023);
+    EXPECT_EQ(filter(0), 0);
+}
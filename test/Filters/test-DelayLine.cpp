@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+#include <Filters/DelayLine.hpp>
+
+TEST(DelayLine, index) {
+    DelayLine<4, int> x = 7;
+    EXPECT_EQ(x[0], 7);
+    EXPECT_EQ(x[3], 7);
+    for (int i = 1; i <= 6; ++i)
+        x.push(i);
+    EXPECT_EQ(x[0], 6);
+    EXPECT_EQ(x[1], 5);
+    EXPECT_EQ(x[2], 4);
+    EXPECT_EQ(x[3], 3);
+}
+
+TEST(DelayLine, mac) {
+    DelayLine<4, int> x;
+    const int h[] = {1, 10, 100, 1000}; // oldest value first
+    x.push(1);
+    EXPECT_EQ(x.mac(h), 1000);
+    x.push(2);
+    EXPECT_EQ(x.mac(h), 2000 + 100);
+    x.push(3);
+    x.push(4);
+    EXPECT_EQ(x.mac(h), 4000 + 300 + 20 + 1);
+    x.push(5);
+    EXPECT_EQ(x.mac(h), 5000 + 400 + 30 + 2);
+}
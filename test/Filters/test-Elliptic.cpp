@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <Filters/Elliptic.hpp>
+
+#include <algorithm>
+#include <array>
+
+TEST(Elliptic, evenOrder) {
+    using namespace std;
+
+    auto filter = ellip<6, double>(0.3, 1, 60);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        0.6880437352850431, 2.9743484553262576, 8.529665987245965,
+        18.113389457026177, 31.37459303257283, 45.10767870338983,
+        54.57359806575643, 54.538076622030744, 43.267026160970666,
+        22.971425195274232, 1.163731370061786, -13.94972312068091,
+        -16.288170492537528, -6.6531196618347135, 8.847442735512178,
+        21.524692814604556, 26.179328318508716, 23.702325945618874,
+        20.80899375521144, 24.330289598023228,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Elliptic, oddOrder) {
+    using namespace std;
+
+    auto filter = ellip<5, double>(0.2, 0.1, 40);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        1.8340788482653765, 4.8552247795923185, 10.512655424206574,
+        19.228802926149022, 29.314963040713266, 39.74252296611897,
+        47.179188877780575, 48.99380039602961, 45.63632371343652,
+        34.62811262217589, 19.871406284536327, 5.9613218143501605,
+        -5.940079606614456, -10.462714823084022, -7.763722102161801,
+        1.0381494922126429, 14.609070487578073, 28.180991064464813,
+        39.71370166079903, 47.822985015544646,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Elliptic, secondOrder) {
+    using namespace std;
+
+    auto filter = ellip<2, double>(0.6, 0.5, 30);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        47.5372144055668, 66.63635031283557, 45.73374541684147,
+        58.04277847910113, 40.73692097205886, 12.5533776664346,
+        -1.5659202223878799, -37.23835821749628, 18.375502834411286,
+        20.78985343401628, -17.61973182886169, 45.073562597381134,
+        19.551488794454443, -18.254597852757566, 29.773700195973035,
+        24.821905483491257, 69.57015672709967, 80.4335112923557,
+        36.35694079355916, 43.11278371954709,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Elliptic, firstOrder) {
+    using namespace std;
+
+    auto filter = ellip<1, double>(0.2, 1, 40);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        38.97009117515155, 51.46383134382576, 54.99932946616525,
+        60.84536575773151, 42.260244204058836, 29.586980220810783,
+        3.019525678999107, -23.8850555816725, 13.046943145475527,
+        2.8781318667515308, 0.6349106415232058, 35.213142187394936,
+        7.767954955267811, 9.897315845024497, 14.264058091923943,
+        22.631670792101033, 64.61674480579907, 66.86395916178385,
+        54.499560463111905, 50.99259483320034,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
+
+TEST(Elliptic, bandpass) {
+    using namespace std;
+
+    SOSFilter<double, 3> filter = analog_prototype2sos_bandpass<double>(
+        ellip_prototype<3>(1, 40), 0.2, 0.4);
+
+    array<double, 20> signal = {100.0, 10.0,  102.0,  23.0,  51.0,  1.0,  -10.0,
+                                -53.0, 100.0, -100.0, 100.0, -10.0, 10.0, 11.0,
+                                20.0,  30.0,  123.0,  12.0,  90.0,  10.0};
+    array<double, 20> expected = {
+        2.763527761463459, 5.25804777202103, 3.859568039094419,
+        -3.4395553307287594, -12.39100349054246, -12.77703860454919,
+        -3.2032436853694852, 8.855447865753966, 17.803067574623253,
+        16.223900442560655, 6.039139071795805, -7.378524868293965,
+        -19.928538865218705, -21.183930538399338, -10.701182889988921,
+        6.751432253544668, 22.979966563815438, 24.931394301661285,
+        9.501520910037106, -13.128524894042476,
+    };
+    transform(signal.begin(), signal.end(), signal.begin(), filter);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-9 * (1 + abs(expected[i])))
+            << "at index " << i;
+}
@@ -0,0 +1,20 @@
+from scipy.signal import sosfilt, ellip
+import numpy as np
+
+signal = np.array((100, 10, 102, 23, 51, 1, -10, -53, 100, -100, 100, -10, 10,
+                   11, 20, 30, 123, 12, 90, 10),
+                  dtype=np.float64)
+
+designs = {
+    'ellip<6, double>(0.3, 1, 60)': ellip(6, 1, 60, 0.3, output='sos'),
+    'ellip<5, double>(0.2, 0.1, 40)': ellip(5, 0.1, 40, 0.2, output='sos'),
+    'ellip<2, double>(0.6, 0.5, 30)': ellip(2, 0.5, 30, 0.6, output='sos'),
+    'ellip<1, double>(0.2, 1, 40)': ellip(1, 1, 40, 0.2, output='sos'),
+    'analog_prototype2sos_bandpass<double>(ellip_prototype<3>(1, 40), 0.2, 0.4)':
+        ellip(3, 1, 40, [0.2, 0.4], 'bandpass', output='sos'),
+}
+for design, sos in designs.items():
+    print(design)
+    print(f'array<double, {len(signal)}> expected = {{')
+    print(' ', ', '.join(map(repr, map(float, sosfilt(sos, signal)))))
+    print('};')
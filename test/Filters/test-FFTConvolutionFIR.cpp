@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <Filters/FFTConvolutionFIR.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+template <size_t N>
+AH::Array<double, N> test_coefficients() {
+    AH::Array<double, N> b;
+    for (size_t i = 0; i < N; ++i)
+        b[i] = std::exp(-double(i) / 50) * std::cos(0.3 * double(i));
+    return b;
+}
+
+std::vector<double> test_signal(size_t length) {
+    std::vector<double> x(length);
+    for (size_t i = 0; i < length; ++i)
+        x[i] = std::sin(0.05 * double(i)) + double(int(i * 7919 % 13) - 6) / 6;
+    return x;
+}
+
+template <size_t N>
+std::vector<double> reference(const AH::Array<double, N> &b,
+                              const std::vector<double> &x) {
+    std::vector<double> y(x.size());
+    for (size_t n = 0; n < x.size(); ++n)
+        for (size_t i = 0; i < N && i <= n; ++i)
+            y[n] += b[i] * x[n - i];
+    return y;
+}
+
+} // namespace
+
+TEST(FFTConvolutionFIR, sampleBySample) {
+    constexpr size_t N = 300;
+    auto b = test_coefficients<N>();
+    auto x = test_signal(1000);
+    auto expected = reference(b, x);
+
+    FFTConvolutionFIR<N, double, 16, 0> filter = b;
+    static_assert(filter.uses_fft, "");
+    static_assert(filter.partitions == 18, "");
+    for (size_t n = 0; n < x.size(); ++n)
+        EXPECT_NEAR(filter(x[n]), expected[n], 1e-10) << n;
+}
+
+TEST(FFTConvolutionFIR, block) {
+    constexpr size_t N = 1024;
+    auto b = test_coefficients<N>();
+    auto x = test_signal(3000);
+    auto expected = reference(b, x);
+
+    FFTConvolutionFIR<N, double, 64, 0> filter = b;
+    // Blocks that are not aligned to the partition size, mixed with single
+    // samples.
+    std::vector<double> y(x.size());
+    size_t n = 0;
+    for (size_t len = 1; n + len <= x.size(); len = (len * 5 + 3) % 150) {
+        filter.process(&x[n], &y[n], len);
+        n += len;
+        if (n < x.size()) {
+            y[n] = filter(x[n]);
+            ++n;
+        }
+    }
+    filter.process(&x[n], &y[n], x.size() - n);
+    for (size_t n = 0; n < x.size(); ++n)
+        EXPECT_NEAR(y[n], expected[n], 1e-10) << n;
+}
+
+TEST(FFTConvolutionFIR, directForm) {
+    constexpr size_t N = 40;
+    auto b = test_coefficients<N>();
+    auto x = test_signal(500);
+    auto expected = reference(b, x);
+
+    FFTConvolutionFIR<N, double, 16> filter = b;
+    static_assert(!filter.uses_fft, "");
+    std::vector<double> y(x.size());
+    filter.process(x.data(), y.data(), 123);
+    for (size_t n = 123; n < x.size(); ++n)
+        y[n] = filter(x[n]);
+    for (size_t n = 0; n < x.size(); ++n)
+        EXPECT_NEAR(y[n], expected[n], 1e-12) << n;
+}
+
+TEST(FFTConvolutionFIR, float) {
+    constexpr size_t N = 2000;
+    auto bd = test_coefficients<N>();
+    AH::Array<float, N> b;
+    for (size_t i = 0; i < N; ++i)
+        b[i] = float(bd[i]);
+    auto x = test_signal(4096);
+    auto expected = reference(bd, x);
+
+    FFTConvolutionFIR<N, float, 128> filter = b;
+    static_assert(filter.uses_fft, "");
+    for (size_t n = 0; n < x.size(); ++n)
+        EXPECT_NEAR(filter(float(x[n])), expected[n], 1e-3) << n;
+}
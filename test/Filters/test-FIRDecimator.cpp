@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <Filters/FIRDecimator.hpp>
+#include <Filters/FIRFilter.hpp>
+
+#include <array>
+#include <cmath>
+
+TEST(FIRDecimator, compareToFIRFilter) {
+    AH::Array<int, 11> b = {{1, 2, 3, -4, -4, 5, 6, 1, 2, 1, -2}};
+    FIRFilter<11, int> reference = b;
+    FIRDecimator<11, 4, int> decimator = b;
+    static_assert(decimator.K == 3, "");
+
+    int seed = 3;
+    unsigned outputs = 0;
+    for (unsigned n = 0; n < 200; ++n) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        int x = (seed >> 16) % 2001 - 1000;
+        int expected = reference(x);
+        bool ready = decimator.update(x);
+        EXPECT_EQ(ready, n % 4 == 3) << n;
+        if (ready) {
+            EXPECT_EQ(decimator.getValue(), expected) << n;
+            ++outputs;
+        }
+    }
+    EXPECT_EQ(outputs, 50u);
+}
+
+TEST(FIRDecimator, blocks) {
+    AH::Array<float, 8> b = {{.1, .2, .3, .4, .4, .3, .2, .1}};
+    FIRFilter<8, float> reference = b;
+    FIRDecimator<8, 8, float> decimator = b;
+
+    std::array<float, 8> block;
+    for (unsigned m = 0; m < 10; ++m) {
+        float expected = 0;
+        for (unsigned i = 0; i < block.size(); ++i) {
+            block[i] = std::sin(0.3f * float(8 * m + i));
+            expected = reference(block[i]);
+        }
+        EXPECT_NEAR(decimator(block.data()), expected, 1e-6) << m;
+    }
+}
+
+TEST(FIRDecimator, factorLargerThanLength) {
+    AH::Array<int, 3> b = {{1, 2, 3}};
+    FIRFilter<3, int> reference = b;
+    FIRDecimator<3, 5, int> decimator = b;
+    for (int n = 0; n < 50; ++n) {
+        int expected = reference(n * n - 7 * n);
+        if (decimator.update(n * n - 7 * n)) {
+            EXPECT_EQ(decimator.getValue(), expected) << n;
+        }
+    }
+}
@@ -2,6 +2,10 @@
 
 #include <Filters/FIRFilter.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 TEST(FIRFilter, FIRFilter1) {
     using namespace std;
 
@@ -36,4 +40,79 @@ TEST(FIRFilter, FIRFilterRandom) {
                                -362, -15, 776, 320,  288,  70};
     for_each(signal.begin(), signal.end(), [&](int &s) { s = filter(s); });
     EXPECT_EQ(signal, expected);
-}
\ No newline at end of file
+}
+
+TEST(FIRFilter, processIntBitIdentical) {
+    using namespace std;
+    AH::Array<int, 11> b = {{1, 2, 3, -4, -4, 5, 6, 1, 2, 1, -2}};
+    FIRFilter<11, int> reference = b;
+    FIRFilter<11, int> filter = b;
+
+    array<int, 203> signal;
+    int seed = 1;
+    for (int &s : signal) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        s = (seed >> 16) % 2001 - 1000;
+    }
+    array<int, 203> expected;
+    transform(signal.begin(), signal.end(), expected.begin(), reference);
+
+    // Mix block sizes that cross the internal block boundaries, as well as
+    // sample-by-sample calls, to make sure the state is carried over.
+    array<int, 203> result;
+    size_t lengths[] = {1, 5, 64, 3, 0, 33, 17, 2, 69};
+    size_t offset = 0;
+    for (size_t len : lengths) {
+        filter.process(signal.data() + offset, result.data() + offset, len);
+        offset += len;
+        if (offset < signal.size()) {
+            result[offset] = filter(signal[offset]);
+            ++offset;
+        }
+    }
+    ASSERT_EQ(offset, signal.size());
+    EXPECT_EQ(result, expected);
+}
+
+TEST(FIRFilter, processFloatInPlace) {
+    using namespace std;
+    AH::Array<float, 7> b = {{0.1, 0.2, -0.3, 0.4, 0.25, -0.15, 0.05}};
+    FIRFilter<7, float> reference = b;
+    FIRFilter<7, float> filter = b;
+
+    array<float, 100> signal;
+    for (size_t i = 0; i < signal.size(); ++i)
+        signal[i] = std::sin(0.1f * i) + 0.01f * (i % 7);
+    array<float, 100> expected;
+    transform(signal.begin(), signal.end(), expected.begin(), reference);
+
+    filter.process(signal.data(), signal.data(), 37);
+    filter.process(signal.data() + 37, signal.data() + 37, 63);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_NEAR(signal[i], expected[i], 1e-6) << i;
+}
+
+TEST(FIRFilter, processOneTap) {
+    using namespace std;
+    FIRFilter<1, int> filter = {{3}};
+    array<int, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                             100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<int, 20> expected;
+    transform(signal.begin(), signal.end(), expected.begin(),
+              [](int s) { return 3 * s; });
+    filter.process(signal.data(), signal.data(), signal.size());
+    EXPECT_EQ(signal, expected);
+}
+
+TEST(FIRFilter, CompactFIRFilterRandom) {
+    using namespace std;
+    CompactFIRFilter<11, int> filter = {{1, 2, 3, -4, -4, 5, 6, 1, 2, 1, -2}};
+    array<int, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                             100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<int, 20> expected = {100,  210, 422, -143, -37,  224,  295,
+                               304,  693, 592, 800,  -163, -113, 180,
+                               -362, -15, 776, 320,  288,  70};
+    for_each(signal.begin(), signal.end(), [&](int &s) { s = filter(s); });
+    EXPECT_EQ(signal, expected);
+    EXPECT_LT(sizeof(filter), sizeof(FIRFilter<11, int>));
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <Filters/FIRFilter.hpp>
+#include <Filters/FIRFilterBank.hpp>
+
+#include <vector>
+
+template <uint8_t N, uint8_t C, class T>
+void compareToCompactFIRFilter(const AH::Array<T, N> &b) {
+    FIRFilterBank<N, C, T> bank = b;
+    std::vector<CompactFIRFilter<N, T>> reference(C, b);
+
+    int seed = 3;
+    for (unsigned n = 0; n < 3 * N + 10; ++n) {
+        AH::Array<T, C> x;
+        for (uint8_t c = 0; c < C; ++c) {
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+            x[c] = T((seed >> 16) % 2001 - 1000) / T(4);
+        }
+        auto y = bank(x);
+        for (uint8_t c = 0; c < C; ++c)
+            EXPECT_EQ(y[c], reference[c](x[c])) << n << ", " << +c;
+    }
+}
+
+TEST(FIRFilterBank, compareToCompactFIRFilterInt) {
+    AH::Array<int, 11> b = {{1, 2, 3, -4, -4, 5, 6, 1, 2, 1, -2}};
+    compareToCompactFIRFilter<11, 1>(b);
+    compareToCompactFIRFilter<11, 3>(b);
+    compareToCompactFIRFilter<11, 16>(b);
+    compareToCompactFIRFilter<11, 19>(b);
+}
+
+TEST(FIRFilterBank, compareToCompactFIRFilterFloat) {
+    AH::Array<float, 7> b = {{0.1, -0.2, 0.3, 0.45, 0.3, -0.2, 0.1}};
+    compareToCompactFIRFilter<7, 5>(b);
+    compareToCompactFIRFilter<7, 32>(b);
+    compareToCompactFIRFilter<7, 37>(b);
+}
+
+TEST(FIRFilterBank, compareToFIRFilter) {
+    AH::Array<double, 5> b = {{0.5, -0.25, 0.125, 1, 0.75}};
+    FIRFilterBank<5, 2, double> bank = b;
+    FIRFilter<5, double> left = b, right = b;
+    for (int n = 0; n < 20; ++n) {
+        double x[2] = {double(n % 7), double(-n)};
+        double y[2];
+        bank(x, y);
+        EXPECT_DOUBLE_EQ(y[0], left(x[0])) << n;
+        EXPECT_DOUBLE_EQ(y[1], right(x[1])) << n;
+    }
+}
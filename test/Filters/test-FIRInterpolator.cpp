@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <Filters/FIRFilter.hpp>
+#include <Filters/FIRInterpolator.hpp>
+
+#include <cmath>
+
+TEST(FIRInterpolator, compareToZeroStuffing) {
+    AH::Array<int, 11> b = {{1, 2, 3, -4, -4, 5, 6, 1, 2, 1, -2}};
+    FIRFilter<11, int> reference = b;
+    FIRInterpolator<11, 3, int> interpolator = b;
+    static_assert(interpolator.K == 4, "");
+
+    int seed = 5;
+    for (unsigned m = 0; m < 100; ++m) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        int x = (seed >> 16) % 2001 - 1000;
+        auto outputs = interpolator(x);
+        EXPECT_EQ(outputs[0], reference(x)) << m;
+        EXPECT_EQ(outputs[1], reference(0)) << m;
+        EXPECT_EQ(outputs[2], reference(0)) << m;
+    }
+}
+
+TEST(FIRInterpolator, linearInterpolation) {
+    // Triangular kernel with DC gain L performs linear interpolation.
+    FIRInterpolator<7, 4, float> interpolator = {{
+        0.25, 0.5, 0.75, 1, 0.75, 0.5, 0.25,
+    }};
+    interpolator(0);
+    float outputs[4];
+    interpolator(4, outputs);
+    EXPECT_FLOAT_EQ(outputs[0], 1);
+    EXPECT_FLOAT_EQ(outputs[1], 2);
+    EXPECT_FLOAT_EQ(outputs[2], 3);
+    EXPECT_FLOAT_EQ(outputs[3], 4);
+    interpolator(8, outputs);
+    EXPECT_FLOAT_EQ(outputs[0], 5);
+    EXPECT_FLOAT_EQ(outputs[1], 6);
+    EXPECT_FLOAT_EQ(outputs[2], 7);
+    EXPECT_FLOAT_EQ(outputs[3], 8);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <Filters/Butterworth.hpp>
+#include <Filters/Chebyshev.hpp>
+#include <Filters/Elliptic.hpp>
+#include <Filters/FilterOrder.hpp>
+
+#include <cmath>
+#include <complex>
+#include <limits>
+
+static void expectOrder(FilterOrder actual, FilterOrder expected) {
+    EXPECT_EQ(actual.N, expected.N);
+    EXPECT_NEAR(actual.f_n, expected.f_n, 1e-12);
+}
+
+TEST(FilterOrder, scipy) {
+    expectOrder(butter_order(0.1, 0.2, 1, 40), {8, 0.10864852703537677});
+    expectOrder(cheby1_order(0.1, 0.2, 1, 40), {5, 0.1});
+    expectOrder(cheby2_order(0.1, 0.2, 1, 40), {5, 0.17706500893171218});
+    expectOrder(ellip_order(0.1, 0.2, 1, 40), {4, 0.1});
+    expectOrder(butter_order(0.3, 0.35, 0.1, 80), {61, 0.30800725233760257});
+    expectOrder(cheby1_order(0.3, 0.35, 0.1, 80), {19, 0.3});
+    expectOrder(cheby2_order(0.3, 0.35, 0.1, 80), {19, 0.34902310744334425});
+    expectOrder(ellip_order(0.3, 0.35, 0.1, 80), {10, 0.3});
+    expectOrder(butter_order(0.05, 0.3, 3, 20), {2, 0.050059152652970874});
+    expectOrder(cheby1_order(0.05, 0.3, 3, 20), {2, 0.05});
+    expectOrder(cheby2_order(0.05, 0.3, 3, 20), {2, 0.11605760219792897});
+    expectOrder(ellip_order(0.05, 0.3, 3, 20), {2, 0.05});
+}
+
+/// Magnitude of the frequency response in decibels.
+template <class T, size_t M>
+double gain_dB(const SOSCoefficients<T, M> &sos, double f_n) {
+    const std::complex<double> z = std::polar(1., -M_PI * f_n);
+    std::complex<double> h = 1;
+    for (const auto &s : sos)
+        h *= (s.b[0] + z * (s.b[1] + z * s.b[2])) /
+             (s.a[0] + z * (s.a[1] + z * s.a[2]));
+    return 20 * std::log10(std::abs(h));
+}
+
+/// Check that the filter meets the specification.
+template <class T, size_t M>
+void expectSpec(const SOSCoefficients<T, M> &sos, double f_pass, double f_stop,
+                double r_pass, double r_stop) {
+    for (double f = 0; f <= f_pass; f += f_pass / 64)
+        EXPECT_GE(gain_dB(sos, f), -r_pass - 1e-9) << f;
+    for (double f = f_stop; f <= 1; f += (1 - f_stop) / 64)
+        EXPECT_LE(gain_dB(sos, f), -r_stop + 1e-9) << f;
+}
+
+TEST(FilterOrder, constexprDesign) {
+    constexpr double fp = 0.1, fs = 0.2, rp = 1, rs = 40;
+    constexpr FilterOrder b = butter_order(fp, fs, rp, rs);
+    constexpr FilterOrder c1 = cheby1_order(fp, fs, rp, rs);
+    constexpr FilterOrder c2 = cheby2_order(fp, fs, rp, rs);
+    constexpr FilterOrder e = ellip_order(fp, fs, rp, rs);
+    static_assert(b.N == 8 && c1.N == 5 && c2.N == 5 && e.N == 4, "");
+    expectSpec(butter_coeff<b.N, double>(b.f_n), fp, fs, rp, rs);
+    expectSpec(cheby1_coeff<c1.N, double>(c1.f_n, rp), fp, fs, rp, rs);
+    expectSpec(cheby2_coeff<c2.N, double>(c2.f_n, rs), fp, fs, rp, rs);
+    expectSpec(ellip_coeff<e.N, double>(e.f_n, rp, rs), fp, fs, rp, rs);
+}
+
+TEST(FilterOrder, invalidSpecification) {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (auto order : {butter_order, cheby1_order, cheby2_order, ellip_order}) {
+        EXPECT_EQ(order(0.1, 0.2, 0, 40).N, 0);
+        EXPECT_EQ(order(0.1, 0.2, -1, 40).N, 0);
+        EXPECT_EQ(order(0.1, 0.2, 1, 0).N, 0);
+        EXPECT_EQ(order(0, 0.2, 1, 40).N, 0);
+        EXPECT_EQ(order(-0.1, 0.2, 1, 40).N, 0);
+        EXPECT_EQ(order(0.2, 0.1, 1, 40).N, 0);
+        EXPECT_EQ(order(0.1, 1, 1, 40).N, 0);
+        EXPECT_EQ(order(nan, 0.2, 1, 40).N, 0);
+        EXPECT_EQ(order(0.1, 0.2, inf, 40).N, 0);
+        EXPECT_EQ(order(0.1, 0.2, 1, inf).N, 0);
+    }
+}
+
+TEST(ConstexprMath, specialValues) {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_EQ(constexpr_sqrt(0), 0);
+    EXPECT_EQ(constexpr_sqrt(-1), 0);
+    EXPECT_EQ(constexpr_sqrt(inf), inf);
+    EXPECT_TRUE(std::isnan(constexpr_sqrt(nan)));
+    EXPECT_EQ(constexpr_log(0), -inf);
+    EXPECT_EQ(constexpr_log(inf), inf);
+    EXPECT_TRUE(std::isnan(constexpr_log(-1)));
+    EXPECT_TRUE(std::isnan(constexpr_log(nan)));
+    EXPECT_EQ(constexpr_exp(inf), inf);
+    EXPECT_EQ(constexpr_exp(-inf), 0);
+    EXPECT_TRUE(std::isnan(constexpr_exp(nan)));
+}
+
+TEST(FilterOrder, tooHigh) {
+    // Orders higher than 255 don't fit in FilterOrder::N.
+    EXPECT_EQ(butter_order(0.3, 0.32, 0.1, 80).N, 146);
+    EXPECT_EQ(butter_order(0.3, 0.31, 0.1, 80).N, 0);
+    EXPECT_EQ(butter_order(0.3, 0.31, 0.1, 80).f_n, 0);
+    EXPECT_EQ(butter_order(0.3, 0.3005, 0.1, 80).N, 0);
+    EXPECT_EQ(cheby1_order(0.3, 0.3005, 0.1, 80).N, 190);
+    EXPECT_EQ(cheby1_order(0.3, 0.3001, 0.1, 80).N, 0);
+    EXPECT_EQ(cheby2_order(0.3, 0.3001, 0.1, 80).N, 0);
+    EXPECT_EQ(butter_order(0.1, 0.2, 1, 1e6).N, 0);
+    EXPECT_EQ(ellip_order(0.1, 0.2, 1, 1e6).N, 0);
+}
@@ -0,0 +1,7 @@
+from scipy.signal import buttord, cheb1ord, cheb2ord, ellipord
+
+specs = [(0.1, 0.2, 1, 40), (0.3, 0.35, 0.1, 80), (0.05, 0.3, 3, 20)]
+for spec in specs:
+    for f in buttord, cheb1ord, cheb2ord, ellipord:
+        N, f_n = f(*spec)
+        print(f'{f.__name__}{spec}: {{{N}, {float(f_n)!r}}}')
@@ -187,4 +187,29 @@ TEST(FixedPoint, sub) {
         EXPECT_FLOAT_EQ(double(input[i] - sub), expected[i]);
         // cout << (expected[i] - double(input[i] - sub)) << '\n';
     }
-}
\ No newline at end of file
+}
+
+TEST(FixedPoint, overflowWrap) {
+    using fp = FixedPoint<int16_t, 8>;
+    EXPECT_EQ(double(fp(100) + fp(100)), 200. - 256.);
+    EXPECT_EQ(double(fp(16) * fp(8)), 128. - 256.);
+    EXPECT_EQ(sizeof(fp), sizeof(int16_t));
+}
+
+TEST(FixedPoint, overflowSaturateCount) {
+    using fp = FixedPoint<int16_t, 8, int32_t, OverflowSaturateCount>;
+    const double max = 32767. / 256;
+    EXPECT_EQ(double(fp(100) + fp(27)), 127.);
+    EXPECT_EQ(fp::overflowPolicy().getOverflowCount(), 0u);
+    EXPECT_EQ(double(fp(100) + fp(100)), max);
+    EXPECT_EQ(double(fp(-100) - fp(100)), -128.);
+    EXPECT_EQ(double(fp(16) * fp(8)), max);
+    EXPECT_EQ(double(fp(-16) * fp(8)), -128.); // exactly the minimum
+    EXPECT_EQ(double(-fp::raw(-32768)), max);
+    EXPECT_EQ(double(fp(1000)), max);
+    EXPECT_EQ(double(fp(100) / fp(0.5)), max);
+    EXPECT_EQ(fp::overflowPolicy().getOverflowCount(), 6u);
+    EXPECT_EQ(fp::overflowPolicy().getPeakMagnitude(), 32768u);
+    fp::overflowPolicy().resetOverflowStatistics();
+    EXPECT_EQ(fp::overflowPolicy().getOverflowCount(), 0u);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <Filters/Butterworth.hpp>
+#include <Filters/FixedPointBiQuad.hpp>
+
+#include <cmath>
+#include <limits>
+
+/// Filter a random signal with half the full-scale amplitude, and return the
+/// RMS error compared to a double precision SOSFilter, in units of the
+/// full-scale range.
+template <class T, bool EF, uint8_t Order>
+double rmsError(double f_n, bool quantizeCoefficients = false,
+                unsigned n = 4000) {
+    constexpr size_t N = (Order + 1) / 2;
+    auto coeff = butter_coeff<Order, double>(f_n);
+    // Optionally round the coefficients of the reference to the fixed-point
+    // format as well, to measure the effect of the rounding of the signals
+    // only.
+    constexpr double q = 1 << (std::numeric_limits<T>::digits - 1);
+    if (quantizeCoefficients)
+        for (auto &section : coeff) {
+            double a0 = section.a[0];
+            for (auto &b : section.b)
+                b = std::round(b / a0 * q) / q;
+            for (auto &a : section.a)
+                a = std::round(a / a0 * q) / q;
+        }
+    FixedPointSOSFilter<T, N, EF> filter = coeff;
+    SOSFilter<double, N> reference = coeff;
+    const double scale = -double(std::numeric_limits<T>::min());
+    int seed = 9;
+    double sum = 0;
+    for (unsigned i = 0; i < n; ++i) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        T x = T(std::lround(((seed >> 16) % 2001 - 1000) / 2000. * scale));
+        double expected = reference(double(x) / scale);
+        double error = double(filter(x)) / scale - expected;
+        sum += error * error;
+    }
+    return std::sqrt(sum / n);
+}
+
+TEST(FixedPointBiQuad, Q15Butterworth) {
+    EXPECT_LT((rmsError<int16_t, false, 4>(0.2)), 4. / 32768);
+    EXPECT_LT((rmsError<int16_t, true, 4>(0.2)), 4. / 32768);
+}
+
+TEST(FixedPointBiQuad, Q31Butterworth) {
+    EXPECT_LT((rmsError<int32_t, false, 6>(0.2)), 1e-8);
+    EXPECT_LT((rmsError<int32_t, true, 6>(0.2)), 1e-8);
+}
+
+TEST(FixedPointBiQuad, errorFeedbackLowCutoff) {
+    double plain = rmsError<int16_t, false, 2>(0.02, true);
+    double feedback = rmsError<int16_t, true, 2>(0.02, true);
+    EXPECT_LT(feedback, plain / 2) << plain << ", " << feedback;
+}
+
+TEST(FixedPointBiQuad, saturate) {
+    // DC gain of 2: y[n] = x[n] + 0.5 y[n-1]
+    FixedPointBiQuad<int16_t> biquad = BiQuadCoefficients<double>{
+        {{1, 0, 0}},
+        {{1, -0.5, 0}},
+    };
+    for (int i = 0; i < 20; ++i) {
+        int16_t y = biquad(30000);
+        EXPECT_GT(y, 0) << i;
+    }
+    EXPECT_EQ(biquad(30000), 32767);
+    for (int i = 0; i < 20; ++i)
+        biquad(-30000);
+    EXPECT_EQ(biquad(-30000), -32768);
+}
+
+TEST(FixedPointBiQuad, exactCoefficients) {
+    // y[n] = 0.5 x[n] + 0.25 x[n-1] - 0.5 y[n-1], all exactly representable.
+    FixedPointBiQuad<int16_t> biquad = BiQuadCoefficients<float>{
+        {{1, 0.5, 0}},
+        {{2, 1, 0}},
+    };
+    EXPECT_EQ(biquad(1000), 500);
+    EXPECT_EQ(biquad(0), 250 - 250);
+    EXPECT_EQ(biquad(-400), -200);
+    EXPECT_EQ(biquad(0), -100 + 100);
+}
+
+TEST(FixedPointBiQuad, setCoefficientsKeepsState) {
+    auto coeff = butter_coeff<4, double>(0.1);
+    FixedPointSOSFilter<int16_t, 2, true> reference = coeff;
+    FixedPointSOSFilter<int16_t, 2, true> retuned = coeff;
+    for (int i = 0; i < 50; ++i) {
+        int16_t x = int16_t((i * 37 % 101 - 50) * 300);
+        EXPECT_EQ(retuned(x), reference(x)) << i;
+        retuned.setCoefficients(coeff);
+    }
+}
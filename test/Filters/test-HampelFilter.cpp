@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <Filters/HampelFilter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+TEST(HampelFilter, removeSpikes) {
+    HampelFilter<5> hampel{3};
+    std::vector<float> signal = {0, 1, 2, 3, 100, 5, 6, 7, 7, 7,
+                                 7, 7, -50, 7, 7, 2, 2, 2, 2, 2};
+    std::vector<float> expected = {0, 1, 2, 3, 5, 5, 6, 7, 7, 7,
+                                   7, 7, 7, 7, 7, 2, 2, 2, 2, 2};
+    for (size_t n = 0; n < signal.size(); ++n) {
+        float y = hampel(signal[n]);
+        if (n >= 2) {
+            EXPECT_EQ(y, expected[n - 2]) << n;
+            EXPECT_EQ(hampel.isOutlier(), n - 2 == 4 || n - 2 == 12) << n;
+        } else {
+            EXPECT_EQ(y, 0) << n;
+        }
+    }
+}
+
+TEST(HampelFilter, keepsEdges) {
+    HampelFilter<7, int> hampel{2, 10};
+    for (int n = 0; n < 20; ++n)
+        EXPECT_EQ(hampel(n < 10 ? 10 : 50), n < 13 ? 10 : 50) << n;
+}
+
+/// Brute-force Hampel filter, using the definition of the median absolute
+/// deviation.
+template <class T>
+struct NaiveHampel {
+    NaiveHampel(size_t N, float k, T initial) : window(N, initial), k(k) {}
+    T operator()(T x) {
+        window.pop_front();
+        window.push_back(x);
+        const size_t h = window.size() / 2;
+        std::vector<T> sorted(window.begin(), window.end());
+        std::nth_element(sorted.begin(), sorted.begin() + h, sorted.end());
+        const T m = sorted[h];
+        for (T &s : sorted)
+            s = s < m ? m - s : s - m;
+        std::nth_element(sorted.begin(), sorted.begin() + h, sorted.end());
+        const T center = window[h];
+        const T deviation = center < m ? m - center : center - m;
+        return float(deviation) > k * 1.4826f * float(sorted[h]) ? m : center;
+    }
+    std::deque<T> window;
+    float k;
+};
+
+template <uint8_t N, class T>
+void compareToNaive(float k, T initial, int range) {
+    HampelFilter<N, T> hampel{k, initial};
+    NaiveHampel<T> reference{N, k, initial};
+    uint32_t seed = N;
+    for (int n = 0; n < 3000; ++n) {
+        seed = seed * 1664525u + 1013904223u;
+        int r = int(seed >> 8);
+        // Mostly small noise, with occasional spikes.
+        T x = T(r % 2 + r / 2 % (2 * range + 1) - range);
+        if (r % 17 == 0)
+            x = T(x + 20 * range);
+        ASSERT_EQ(hampel(x), reference(x)) << "N = " << +N << ", n = " << n;
+    }
+}
+
+TEST(HampelFilter, compareToNaive) {
+    compareToNaive<1, int>(3, 0, 10);
+    compareToNaive<3, int>(3, 5, 10);
+    compareToNaive<5, float>(2, 0, 4);
+    compareToNaive<7, int>(0, 0, 1);
+    compareToNaive<11, uint16_t>(3, 100, 30);
+    compareToNaive<31, float>(3, 1.5f, 100);
+    compareToNaive<101, int>(2.5f, 0, 1000);
+    compareToNaive<255, int>(3, -20, 1000);
+}
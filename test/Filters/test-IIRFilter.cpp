@@ -2,6 +2,10 @@
 
 #include <Filters/IIRFilter.hpp>
 
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
 TEST(IIRFilter, IIRFilterRandomInt) {
     using namespace std;
     IIRFilter<5, 3, int> filter = {{1, 10, 2, -3, -1}, {-1, 2, -3}};
@@ -29,4 +33,81 @@ TEST(IIRFilter, IIRFilterRandomDouble) {
     };
     for_each(signal.begin(), signal.end(), [&](double &s) { s = filter(s); });
     EXPECT_EQ(signal, expected);
-}
\ No newline at end of file
+}
+
+TEST(IIRFilter, CompactIIRFilterRandomInt) {
+    using namespace std;
+    CompactIIRFilter<5, 3, int> filter = {{1, 10, 2, -3, -1}, {-1, 2, -3}};
+    array<int, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                             100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<int, 20> expected = {-100,     -1210,    -2522,   -2177,    2857,
+                               12004,    15506,    -4673,   -55360,   -97524,
+                               -28437,   235155,   555311,  405266,   -855481,
+                               -2926992, -3287961, 2203823, 14271183, 21930362};
+    for_each(signal.begin(), signal.end(), [&](int &s) { s = filter(s); });
+    EXPECT_EQ(signal, expected);
+}
+
+TEST(IIRFilter, CompactIIRFilterRandomDouble) {
+    using namespace std;
+    CompactIIRFilter<5, 3, double> filter = {{1, 10, 2, -3, -1}, {-1, 2, -3}};
+    array<double, 20> signal = {
+        100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+        100, -10, 10,  11, 20, 30, 123, 12,  90,  10,
+    };
+    array<double, 20> expected = {
+        -100,    -1210,    -2522,    -2177,   2857,     12004,    15506,
+        -4673,   -55360,   -97524,   -28437,  235155,   555311,   405266,
+        -855481, -2926992, -3287961, 2203823, 14271183, 21930362,
+    };
+    for_each(signal.begin(), signal.end(), [&](double &s) { s = filter(s); });
+    EXPECT_EQ(signal, expected);
+}
+
+TEST(IIRFilter, CompactIIRFilterSize) {
+    EXPECT_LT(sizeof(CompactIIRFilter<5, 3, int>), sizeof(IIRFilter<5, 3, int>));
+}
+
+// Same members as NonNormalizingIIRFilter, without the overflow policy base
+// class.
+template <uint8_t NB, uint8_t NA, class T>
+struct IIRFilterWithoutPolicy {
+    uint8_t index_b, index_a;
+    AH::Array<T, NB> x;
+    AH::Array<T, NA - 1> y;
+    AH::Array<T, 2 * NB - 1> b_coefficients;
+    AH::Array<T, 2 * NA - 3> a_coefficients;
+    T a0;
+};
+
+TEST(IIRFilter, IIRFilterOverflowWrap) {
+    IIRFilter<2, 2, int16_t> filter = {{2, 0}, {1, 0}};
+    EXPECT_EQ(filter(10000), 20000);
+    EXPECT_EQ(filter(20000), 40000 - 65536);
+    // The policy takes up no space.
+    EXPECT_TRUE(std::is_empty<OverflowWrap>::value);
+    EXPECT_EQ(sizeof(filter), (sizeof(IIRFilterWithoutPolicy<2, 2, int16_t>)));
+}
+
+TEST(IIRFilter, IIRFilterOverflowSaturate) {
+    IIRFilter<2, 2, int16_t, OverflowSaturate> filter = {{2, 0}, {1, 0}};
+    EXPECT_EQ(filter(10000), 20000);
+    EXPECT_EQ(filter(20000), 32767);
+    EXPECT_EQ(filter(-20000), -32768);
+}
+
+TEST(IIRFilter, IIRFilterOverflowSaturateCount) {
+    // y[n] = x[n] + x[n-1] - 0.5 y[n-1], with a₀ = 2
+    IIRFilter<2, 2, int16_t, OverflowSaturateCount> filter = {{2, 2}, {2, 1}};
+    EXPECT_EQ(filter(5000), 5000);
+    EXPECT_EQ(filter(5000), 7500);
+    EXPECT_EQ(filter.getOverflowCount(), 0u);
+    EXPECT_EQ(filter.getPeakMagnitude(), 20000u);
+    // 2·20000 saturates, adding 2·5000 saturates again
+    EXPECT_EQ(filter(20000), (32767 - 7500) / 2);
+    EXPECT_EQ(filter.getOverflowCount(), 2u);
+    EXPECT_EQ(filter.getPeakMagnitude(), 32767u);
+    filter.resetOverflowStatistics();
+    EXPECT_EQ(filter.getOverflowCount(), 0u);
+    EXPECT_EQ(filter.getPeakMagnitude(), 0u);
+}
@@ -3,6 +3,7 @@
 #include <Filters/MedianFilter.hpp>
 
 #include <algorithm>
+#include <array>
 
 TEST(MedianFilter, odd) {
     MedianFilter<5> med = 3.14;
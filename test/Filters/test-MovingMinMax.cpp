@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <Filters/MovingMinMax.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+
+TEST(MovingMax, peakHold) {
+    MovingMax<3> max = 2;
+    std::array<float, 10> signal = {1, 5, 3, 4, 2, 1, 0, 7, 7, 6};
+    std::array<float, 10> expected = {2, 5, 5, 5, 4, 4, 2, 7, 7, 7};
+    std::transform(signal.begin(), signal.end(), signal.begin(), max);
+    EXPECT_EQ(signal, expected);
+}
+
+TEST(MovingMin, ramp) {
+    MovingMin<4, int> min;
+    std::array<int, 10> signal = {5, 4, 3, 2, 1, 2, 3, 4, 5, 6};
+    std::array<int, 10> expected = {0, 0, 0, 2, 1, 1, 1, 1, 2, 3};
+    std::transform(signal.begin(), signal.end(), signal.begin(), min);
+    EXPECT_EQ(signal, expected);
+}
+
+/// Compare to a brute-force search of the window, for random inputs with many
+/// duplicates, and for long ramps. Runs for more than 256 samples, so the
+/// time stamps wrap around.
+template <uint8_t N, class T>
+void compareToBruteForce(T initial, int range) {
+    MovingMin<N, T> min = initial;
+    MovingMax<N, T> max = initial;
+    MovingRange<N, T> rng = initial;
+    std::deque<T> window(N, initial);
+    uint32_t seed = N;
+    for (int n = 0; n < 3000; ++n) {
+        seed = seed * 1664525u + 1013904223u;
+        T x = n % 1000 < 500 ? T(int(seed >> 8) % (2 * range + 1) - range)
+                             : T(n % 300 < 150 ? n % 150 : -n % 150);
+        window.pop_front();
+        window.push_back(x);
+        T expected_min = *std::min_element(window.begin(), window.end());
+        T expected_max = *std::max_element(window.begin(), window.end());
+        ASSERT_EQ(min(x), expected_min) << "N = " << +N << ", n = " << n;
+        ASSERT_EQ(max(x), expected_max) << "N = " << +N << ", n = " << n;
+        ASSERT_EQ(rng(x), expected_max - expected_min) << +N << ", " << n;
+        ASSERT_EQ(rng.getMinimum(), expected_min);
+        ASSERT_EQ(rng.getMaximum(), expected_max);
+    }
+}
+
+TEST(MovingRange, compareToBruteForce) {
+    compareToBruteForce<1, int>(0, 100);
+    compareToBruteForce<2, int>(-3, 100);
+    compareToBruteForce<3, int>(5, 2);
+    compareToBruteForce<16, int>(0, 1000);
+    compareToBruteForce<31, float>(1.5f, 50);
+    compareToBruteForce<101, int16_t>(3, 10);
+    compareToBruteForce<200, int>(0, 1000);
+    compareToBruteForce<255, int>(7, 1000);
+}
+
+/// Monotonic inputs keep every sample in the wedge, so it stays full, and the
+/// ring indices front + size exceed 255 for large N.
+template <uint8_t N>
+void longMonotonicRamps() {
+    MovingMin<N, int> min;
+    MovingMax<N, int> max;
+    for (int n = 0; n < 3 * N; ++n) {
+        int expected = n < N ? 0 : n - N + 1;
+        ASSERT_EQ(min(n), expected) << "N = " << +N << ", n = " << n;
+        ASSERT_EQ(max(-n), -expected) << "N = " << +N << ", n = " << n;
+    }
+}
+
+TEST(MovingMinMax, longMonotonicRamps) {
+    longMonotonicRamps<200>();
+    longMonotonicRamps<255>();
+}
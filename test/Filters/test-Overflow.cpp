@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <Filters/Overflow.hpp>
+
+TEST(Overflow, saturateSigned) {
+    using A = OverflowArithmetic<int8_t>;
+    bool overflow = false;
+    EXPECT_EQ(A::saturateAdd(100, 27, overflow), 127);
+    EXPECT_EQ(A::saturateSub(-100, 28, overflow), -128);
+    EXPECT_EQ(A::saturateMul(-16, 8, overflow), -128);
+    EXPECT_EQ(A::saturateMul(-1, -127, overflow), 127);
+    EXPECT_FALSE(overflow);
+    EXPECT_EQ(A::saturateAdd(100, 28, overflow), 127);
+    EXPECT_TRUE(overflow);
+    overflow = false;
+    EXPECT_EQ(A::saturateSub(0, -128, overflow), 127);
+    EXPECT_TRUE(overflow);
+    overflow = false;
+    EXPECT_EQ(A::saturateMul(-1, -128, overflow), 127);
+    EXPECT_TRUE(overflow);
+    overflow = false;
+    EXPECT_EQ(A::saturateMul(3, -43, overflow), -128);
+    EXPECT_TRUE(overflow);
+    overflow = false;
+    EXPECT_EQ(A::saturateNarrow(-129, overflow), -128);
+    EXPECT_TRUE(overflow);
+}
+
+TEST(Overflow, saturateUnsigned) {
+    using A = OverflowArithmetic<uint16_t>;
+    bool overflow = false;
+    EXPECT_EQ(A::saturateAdd(65000, 535, overflow), 65535);
+    EXPECT_EQ(A::saturateMul(255, 257, overflow), 65535);
+    EXPECT_FALSE(overflow);
+    EXPECT_EQ(A::saturateSub(1, 2, overflow), 0);
+    EXPECT_TRUE(overflow);
+    overflow = false;
+    EXPECT_EQ(A::saturateMul(256, 256, overflow), 65535);
+    EXPECT_TRUE(overflow);
+    overflow = false;
+    EXPECT_EQ(A::saturateNarrow(-1, overflow), 0);
+    EXPECT_TRUE(overflow);
+    overflow = false;
+    EXPECT_EQ(A::saturateNarrow(70000u, overflow), 65535);
+    EXPECT_TRUE(overflow);
+}
+
+TEST(Overflow, saturate64) {
+    using A = OverflowArithmetic<int64_t>;
+    constexpr int64_t max = std::numeric_limits<int64_t>::max();
+    constexpr int64_t min = std::numeric_limits<int64_t>::min();
+    bool overflow = false;
+    EXPECT_EQ(A::saturateMul(int64_t(1) << 31, int64_t(1) << 31, overflow),
+              int64_t(1) << 62);
+    EXPECT_EQ(A::saturateMul(-(int64_t(1) << 32), int64_t(1) << 31, overflow),
+              min);
+    EXPECT_FALSE(overflow);
+    EXPECT_EQ(A::saturateMul(int64_t(1) << 32, int64_t(1) << 31, overflow),
+              max);
+    EXPECT_TRUE(overflow);
+    overflow = false;
+    EXPECT_EQ(A::saturateMul(min, -1, overflow), max);
+    EXPECT_TRUE(overflow);
+    EXPECT_EQ(A::magnitude(min), uintmax_t(1) << 63);
+}
+
+TEST(Overflow, wrap) {
+    using A = OverflowArithmetic<int16_t>;
+    EXPECT_EQ(A::wrapAdd(32767, 1), -32768);
+    EXPECT_EQ(A::wrapSub(-32768, 1), 32767);
+    EXPECT_EQ(A::wrapMul(256, 128), -32768);
+    using B = OverflowArithmetic<uint16_t>;
+    EXPECT_EQ(B::wrapMul(65535, 65535), 1); // no signed int overflow
+}
+
+TEST(Overflow, wrapIsEmpty) {
+    struct S : OverflowWrap {
+        int i;
+    };
+    EXPECT_EQ(sizeof(S), sizeof(int));
+}
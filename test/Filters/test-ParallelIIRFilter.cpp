@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <Filters/Butterworth.hpp>
+#include <Filters/IIRFilter.hpp>
+#include <Filters/ParallelIIRFilter.hpp>
+
+#include <cmath>
+
+template <class Reference, class Filter>
+void compareFilters(Reference &reference, Filter &filter, double tolerance) {
+    int seed = 11;
+    for (unsigned n = 0; n < 500; ++n) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        double x = n == 0 ? 1 : ((seed >> 16) % 2001 - 1000) / 1000.;
+        double expected = reference(x);
+        EXPECT_NEAR(filter(x), expected, tolerance) << n;
+    }
+}
+
+TEST(ParallelIIRFilter, butterworthEven) {
+    auto sos = butter_coeff<6, double>(0.3);
+    SOSFilter<double, 3> reference = sos;
+    auto coeff = tf2parallel(sos2tf(sos));
+    static_assert(coeff.sections.length == 3, "");
+    ParallelIIRFilter<double, 3> filter = coeff;
+    compareFilters(reference, filter, 1e-12);
+}
+
+TEST(ParallelIIRFilter, butterworthOdd) {
+    auto sos = butter_coeff<7, double>(0.1);
+    SOSFilter<double, 4> reference = sos;
+    auto coeff = tf2parallel(sos2tf(sos));
+    ParallelIIRFilter<double, 4> filter = coeff;
+    compareFilters(reference, filter, 1e-10);
+}
+
+TEST(ParallelIIRFilter, float) {
+    auto sos = butter_coeff<8, double>(0.25);
+    SOSFilter<double, 4> reference = sos;
+    auto coeff = tf2parallel(sos2tf(sos));
+    // Design in double precision, round the coefficients of the sections.
+    ParallelCoefficients<float, 4> coeff_f;
+    for (size_t k = 0; k < 4; ++k) {
+        coeff_f.sections[k].b = AH::copyAs<float>(coeff.sections[k].b);
+        coeff_f.sections[k].a = AH::copyAs<float>(coeff.sections[k].a);
+    }
+    coeff_f.direct = AH::copyAs<float>(coeff.direct);
+    ParallelIIRFilter<float, 4> filter = coeff_f;
+    int seed = 11;
+    for (unsigned n = 0; n < 500; ++n) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        float x = float((seed >> 16) % 2001 - 1000) / 1000.f;
+        EXPECT_NEAR(filter(x), reference(double(x)), 1e-4) << n;
+    }
+}
+
+TEST(ParallelIIRFilter, realPolesAndDirectTerm) {
+    // (1 - 0.5 z⁻¹)(1 + 0.25 z⁻¹)(1 - 0.8 z⁻¹) in the denominator, and a
+    // numerator of higher degree, which results in a direct FIR term.
+    TransferFunction<6, 4, double> tf = {
+        {{1, -0.3, 0.7, 0.2, -0.1, 0.05}},
+        {{1, -1.05, 0.075, 0.1}},
+    };
+    IIRFilter<6, 4, double> reference = tf;
+    auto coeff = tf2parallel(tf);
+    static_assert(coeff.sections.length == 2, "");
+    static_assert(coeff.direct.length == 3, "");
+    ParallelIIRFilter<double, 2, 3> filter = coeff;
+    compareFilters(reference, filter, 1e-12);
+}
@@ -3,6 +3,7 @@
 #include <AH/Containers/ArrayHelpers.hpp>
 #include <Filters/SMA.hpp>
 #include <numeric>
+#include <type_traits>
 
 TEST(SMA, divRoundSigned) {
     using namespace std;
@@ -43,6 +44,7 @@ TEST(SMA, divRoundUnsigned) {
 }
 
 #include <algorithm>
+#include <array>
 
 TEST(SMA, smaFloat) {
     SMA<10, float, float> sma;
@@ -87,4 +89,47 @@ TEST(SMA, smaUintInitial) {
     std::for_each(signal.begin(), signal.end(),
                   [&](uint16_t &s) { s = sma(s); });
     ASSERT_EQ(signal, expected);
-}
\ No newline at end of file
+}
+
+TEST(SMA, smaOverflowSaturateCount) {
+    SMA<4, uint8_t, uint8_t, OverflowSaturateCount> sma;
+    std::array<uint8_t, 8> signal = {
+        100, 100, 100, 100, 0, 0, 0, 0,
+    };
+    std::array<uint8_t, 8> expected = {
+        25, 50, 64, 64, 64, 50, 25, 0,
+    };
+    std::for_each(signal.begin(), signal.end(),
+                  [&](uint8_t &s) { s = sma(s); });
+    ASSERT_EQ(signal, expected);
+    EXPECT_EQ(sma.getOverflowCount(), 4u);
+    EXPECT_EQ(sma.getPeakMagnitude(), 255u);
+}
+
+TEST(SMA, smaOverflowSaturateSigned) {
+    SMA<2, int8_t, int8_t, OverflowSaturate> sma;
+    std::array<int8_t, 6> signal = {
+        -100, -100, -100, 20, 20, 0,
+    };
+    std::array<int8_t, 6> expected = {
+        -50, -64, -64, -40, 20, 10,
+    };
+    std::for_each(signal.begin(), signal.end(),
+                  [&](int8_t &s) { s = sma(s); });
+    ASSERT_EQ(signal, expected);
+}
+
+// Same members as SMA, without the overflow policy base class.
+template <uint8_t N, class input_t = uint16_t, class sum_t = uint32_t>
+struct SMAWithoutPolicy {
+    uint8_t index;
+    input_t previousInputs[N];
+    sum_t sum;
+};
+
+TEST(SMA, smaOverflowWrapSize) {
+    EXPECT_TRUE(std::is_empty<OverflowWrap>::value);
+    EXPECT_EQ(sizeof(SMA<4>), sizeof(SMAWithoutPolicy<4>));
+    EXPECT_EQ((sizeof(SMA<4, uint8_t, uint16_t>)),
+              (sizeof(SMAWithoutPolicy<4, uint8_t, uint16_t>)));
+}
@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <Filters/Butterworth.hpp>
 #include <Filters/IIRFilter.hpp>
 #include <Filters/SOSFilter.hpp>
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 /*
  *  (1 + 2 s⁻¹ + 3 s⁻²) (4 + 5 s⁻1 + 6 s⁻²) 
  * ----------------------------------------  =
@@ -26,4 +31,111 @@ TEST(SOSFilter, SOSFilter) {
     transform(signal.begin(), signal.end(), signal.begin(), sos);
     transform(expected.begin(), expected.end(), expected.begin(), reference);
     EXPECT_EQ(signal, expected);
-}
\ No newline at end of file
+}
+
+TEST(SOSFilter, SOSFilterDF2T) {
+    using namespace std;
+    IIRFilter<5, 5, int> reference = {{4, 13, 28, 27, 18}, {-1, 1, 7, -13, 6}};
+    SOSFilter<int, 2, BiQuadFilterDF2T<int>> sos = {{{
+        {{1, 2, 3}, {-1, -2, 3}},
+        {{4, 5, 6}, {1, -3, 2}},
+    }}};
+    array<int, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                             100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<int, 20> expected = signal;
+    transform(signal.begin(), signal.end(), signal.begin(), sos);
+    transform(expected.begin(), expected.end(), expected.begin(), reference);
+    EXPECT_EQ(signal, expected);
+}
+
+template <class Implementation, class T>
+void testSOSFilterProcess() {
+    auto coeff = butter_coeff<10, T>(0.15);
+    SOSFilter<T, 5, Implementation> reference = coeff;
+    SOSFilter<T, 5, Implementation> block = coeff;
+    std::vector<T> signal(200), expected(200);
+    for (size_t i = 0; i < signal.size(); ++i)
+        signal[i] = T(int(i * 37 % 101) - 50);
+    std::transform(signal.begin(), signal.end(), expected.begin(), reference);
+    // In place, in blocks of varying length.
+    for (size_t i = 0, len = 1; i < signal.size(); i += len, len = 2 * len + 1)
+        block.process(&signal[i], &signal[i],
+                      std::min(len, signal.size() - i));
+    EXPECT_EQ(signal, expected);
+}
+
+TEST(SOSFilter, processDF1) {
+    testSOSFilterProcess<BiQuadFilterDF1<float>, float>();
+    testSOSFilterProcess<BiQuadFilterDF1<double>, double>();
+}
+
+TEST(SOSFilter, processDF2) {
+    testSOSFilterProcess<BiQuadFilterDF2<float>, float>();
+    testSOSFilterProcess<NonNormalizingBiQuadFilterDF2<double>, double>();
+}
+
+TEST(SOSFilter, processDF2T) {
+    testSOSFilterProcess<BiQuadFilterDF2T<float>, float>();
+    testSOSFilterProcess<NonNormalizingBiQuadFilterDF2T<float>, float>();
+}
+
+TEST(SOSFilter, processInt) {
+    using namespace std;
+    SOSFilter<int, 2> reference = {{{
+        {{1, 2, 3}, {-1, -2, 3}},
+        {{4, 5, 6}, {1, -3, 2}},
+    }}};
+    auto block = reference;
+    array<int, 20> signal = {100, 10,  102, 23, 51, 1,  -10, -53, 100, -100,
+                             100, -10, 10,  11, 20, 30, 123, 12,  90,  10};
+    array<int, 20> expected = signal;
+    transform(expected.begin(), expected.end(), expected.begin(), reference);
+    block.process(signal.data(), signal.data(), 9);
+    block.process(signal.data() + 9, signal.data() + 9, 11);
+    EXPECT_EQ(signal, expected);
+}
+
+template <class Implementation, class T>
+void testSOSFilterSetCoefficients() {
+    auto coeff = butter_coeff<6, T>(0.2);
+    SOSFilter<T, 3, Implementation> reference = coeff;
+    SOSFilter<T, 3, Implementation> retuned = coeff;
+    for (int i = 0; i < 50; ++i) {
+        T x = T(i * 37 % 101 - 50);
+        EXPECT_EQ(retuned(x), reference(x)) << i;
+        // Setting the same coefficients again must not reset the state.
+        retuned.setCoefficients(coeff);
+    }
+}
+
+TEST(SOSFilter, setCoefficientsKeepsState) {
+    testSOSFilterSetCoefficients<BiQuadFilterDF1<double>, double>();
+    testSOSFilterSetCoefficients<NonNormalizingBiQuadFilterDF1<float>,
+                                 float>();
+    testSOSFilterSetCoefficients<BiQuadFilterDF2<float>, float>();
+    testSOSFilterSetCoefficients<NonNormalizingBiQuadFilterDF2<double>,
+                                 double>();
+    testSOSFilterSetCoefficients<BiQuadFilterDF2T<double>, double>();
+    testSOSFilterSetCoefficients<NonNormalizingBiQuadFilterDF2T<float>,
+                                 float>();
+}
+
+TEST(SOSFilter, setCoefficients) {
+    // Direct Form 1 keeps the previous inputs and outputs, so the difference
+    // equation continues with the new coefficients.
+    BiQuadCoefficients<double> c1 = {{{1, 2, 3}}, {{2, 1, 0.5}}};
+    BiQuadCoefficients<double> c2 = {{{4, -1, 2}}, {{4, -2, 1}}};
+    SOSFilter<double, 1> sos = SOSCoefficients<double, 1>{{c1}};
+    std::array<double, 2> x = {}, y = {};
+    for (int i = 0; i < 20; ++i) {
+        const auto &c = i < 10 ? c1 : c2;
+        if (i == 10)
+            sos.setCoefficients({{c2}});
+        const double in = i * 7 % 11 - 5;
+        const double out = (c.b[0] * in + c.b[1] * x[0] + c.b[2] * x[1] -
+                            c.a[1] * y[0] - c.a[2] * y[1]) /
+                           c.a[0];
+        x = {in, x[0]}, y = {out, y[0]};
+        EXPECT_NEAR(sos(in), out, 1e-12 * (1 + std::abs(out))) << i;
+    }
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <Filters/Butterworth.hpp>
+#include <Filters/SOSFilterBank.hpp>
+
+#include <algorithm>
+#include <vector>
+
+template <size_t C, class T>
+void compareToSOSFilter() {
+    auto coeff = butter_coeff<6, T>(0.2);
+    SOSFilterBank<T, 3, C> bank = coeff;
+    std::vector<SOSFilter<T, 3>> reference(C, coeff);
+
+    int seed = 7;
+    for (unsigned n = 0; n < 200; ++n) {
+        AH::Array<T, C> x;
+        for (size_t c = 0; c < C; ++c) {
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+            x[c] = T((seed >> 16) % 2001 - 1000) / T(100);
+        }
+        auto y = bank(x);
+        for (size_t c = 0; c < C; ++c)
+            EXPECT_NEAR(y[c], reference[c](x[c]), 1e-4) << n << ", " << c;
+    }
+}
+
+TEST(SOSFilterBank, compareToSOSFilter) {
+    compareToSOSFilter<1, float>();
+    compareToSOSFilter<4, float>();
+    compareToSOSFilter<5, float>();
+    compareToSOSFilter<16, float>();
+    compareToSOSFilter<19, float>();
+    compareToSOSFilter<3, double>();
+    compareToSOSFilter<8, double>();
+}
+
+TEST(SOSFilterBank, processEqualsFrameByFrame) {
+    constexpr size_t C = 11, n = 97;
+    auto coeff = butter_coeff<4, float>(0.1);
+    SOSFilterBank<float, 2, C> frames = coeff, block = coeff;
+
+    std::vector<float> x(C * n), expected(C * n);
+    for (size_t i = 0; i < x.size(); ++i)
+        x[i] = float(int(i * 37 % 101) - 50);
+    for (size_t i = 0; i < n; ++i)
+        frames(&x[i * C], &expected[i * C]);
+    // In place, in blocks of varying length.
+    for (size_t i = 0, len = 1; i < n; i += len, len = len * 2 + 1)
+        block.process(&x[i * C], &x[i * C], std::min(len, n - i));
+    EXPECT_EQ(x, expected);
+}
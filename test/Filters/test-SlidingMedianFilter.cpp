@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <Filters/MedianFilter.hpp>
+#include <Filters/SlidingMedianFilter.hpp>
+
+#include <algorithm>
+#include <array>
+
+TEST(SlidingMedianFilter, odd) {
+    SlidingMedianFilter<5> med = 3.14;
+    std::array<float, 12> signal = {
+        100.0, 100.0, 25.0, 25.0, 50.0, 123.0,
+        465.0, 75.0,  56.0, 50.0, 23.0, 41.0,
+    };
+    std::array<float, 12> expected = {
+        3.14, 3.14, 25.0, 25.0, 50.0, 50.0,
+        50.0, 75.0, 75.0, 75.0, 56.0, 50.0,
+    };
+    std::transform(signal.begin(), signal.end(), signal.begin(), med);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_FLOAT_EQ(signal[i], expected[i]) << i;
+}
+
+TEST(SlidingMedianFilter, even) {
+    SlidingMedianFilter<6> med = 3.14;
+    std::array<float, 12> signal = {
+        100.0, 100.0, 25.0, 25.0, 50.0, 123.0,
+        465.0, 75.0,  56.0, 50.0, 23.0, 41.0,
+    };
+    std::array<float, 12> expected = {
+        3.14, 3.14, 14.07, 25.0, 37.5, 75.0,
+        75.0, 62.5, 65.5,  65.5, 65.5, 53.0,
+    };
+    std::transform(signal.begin(), signal.end(), signal.begin(), med);
+    for (size_t i = 0; i < signal.size(); ++i)
+        EXPECT_FLOAT_EQ(signal[i], expected[i]) << i;
+}
+
+/// Compare to MedianFilter for random inputs with many duplicates.
+template <uint8_t N, class T>
+void compareToMedianFilter(T initial, int range) {
+    MedianFilter<N, T> reference = initial;
+    SlidingMedianFilter<N, T> filter = initial;
+    uint32_t seed = N;
+    for (int n = 0; n < 2000; ++n) {
+        seed = seed * 1664525u + 1013904223u;
+        T x = T(int(seed >> 8) % (2 * range + 1) - range);
+        ASSERT_EQ(filter(x), reference(x)) << "N = " << +N << ", n = " << n;
+    }
+}
+
+TEST(SlidingMedianFilter, compareToMedianFilter) {
+    compareToMedianFilter<1, int>(0, 100);
+    compareToMedianFilter<2, int>(0, 100);
+    compareToMedianFilter<3, int>(-5, 100);
+    compareToMedianFilter<4, int>(7, 3);
+    compareToMedianFilter<7, int>(0, 2);
+    compareToMedianFilter<16, int>(0, 1000);
+    compareToMedianFilter<31, float>(1.5f, 50);
+    compareToMedianFilter<100, float>(0, 1000);
+    compareToMedianFilter<101, int>(3, 10);
+    compareToMedianFilter<255, int>(0, 1000);
+}
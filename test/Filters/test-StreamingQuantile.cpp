@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <Filters/StreamingQuantile.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+TEST(StreamingQuantile, paperExample) {
+    // Example from Jain and Chlamtac (1985), table I.
+    std::vector<double> signal = {
+        0.02,  0.15, 0.74, 3.39,  0.83,  22.37, 10.15, 15.43, 38.62, 15.92,
+        34.60, 10.28, 1.47, 0.40, 0.05, 11.39, 0.27,  0.42,  0.09,  11.37,
+    };
+    StreamingQuantile<double> median(0.5);
+    std::vector<double> output;
+    for (double x : signal)
+        output.push_back(median(x));
+    // The first five outputs are exact.
+    EXPECT_EQ(output[0], 0.02);
+    EXPECT_EQ(output[1], 0.15); // rounded up
+    EXPECT_EQ(output[2], 0.15);
+    EXPECT_EQ(output[3], 0.74);
+    EXPECT_EQ(output[4], 0.74);
+    EXPECT_NEAR(output[5], 0.74, 0.005);
+    EXPECT_NEAR(output[19], 4.44, 0.005);
+    EXPECT_EQ(median.getCount(), 20u);
+}
+
+static double randomUniform(uint32_t &seed) {
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) / double(1u << 24);
+}
+
+TEST(StreamingQuantile, uniform) {
+    StreamingQuantile<double, 3> quantiles = {{0.5, 0.95, 0.99}};
+    uint32_t seed = 1;
+    double y = 0;
+    for (int n = 0; n < 100000; ++n)
+        y = quantiles(100 * randomUniform(seed));
+    EXPECT_EQ(y, quantiles.getQuantile(0));
+    EXPECT_NEAR(quantiles.getQuantile(0), 50, 0.5);
+    EXPECT_NEAR(quantiles.getQuantile(1), 95, 0.5);
+    EXPECT_NEAR(quantiles.getQuantile(2), 99, 0.5);
+}
+
+TEST(StreamingQuantile, exponential) {
+    // Skewed distribution with a long tail, p-quantile is -ln(1 - p).
+    const double p[] = {0.1, 0.5, 0.9, 0.95, 0.99};
+    StreamingQuantile<float, 5> quantiles = {{0.1, 0.5, 0.9, 0.95, 0.99}};
+    uint32_t seed = 2;
+    for (int n = 0; n < 200000; ++n)
+        quantiles(float(-std::log(1 - randomUniform(seed))));
+    for (uint8_t i = 0; i < 5; ++i) {
+        double expected = -std::log(1 - p[i]);
+        EXPECT_NEAR(quantiles.getQuantile(i), expected, 0.02 * expected)
+            << p[i];
+    }
+    quantiles.reset();
+    EXPECT_EQ(quantiles.getCount(), 0u);
+    EXPECT_EQ(quantiles(42), 42);
+}
+
+TEST(StreamingQuantile, invalidQuantiles) {
+    // StreamingQuantile<> q = 3.14 should not compile.
+    static_assert(!std::is_convertible<double, StreamingQuantile<double>>::value,
+                  "");
+    EXPECT_THROW(StreamingQuantile<double>(0), AH::ErrorException);
+    EXPECT_THROW(StreamingQuantile<double>(1), AH::ErrorException);
+    EXPECT_THROW(StreamingQuantile<double>(3.14), AH::ErrorException);
+    EXPECT_THROW(StreamingQuantile<double>(NAN), AH::ErrorException);
+    using SQ2 = StreamingQuantile<double, 2>;
+    EXPECT_THROW(SQ2(AH::Array<double, 2>{{0.9, 0.5}}), AH::ErrorException);
+    EXPECT_THROW(SQ2(AH::Array<double, 2>{{0.5, 0.5}}), AH::ErrorException);
+    EXPECT_NO_THROW(SQ2(AH::Array<double, 2>{{0.5, 0.9}}));
+}
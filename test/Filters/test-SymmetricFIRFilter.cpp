@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <Filters/FIRFilter.hpp>
+#include <Filters/SymmetricFIRFilter.hpp>
+
+template <uint8_t N, bool Antisymmetric>
+void testSymmetricFIRFilter() {
+    constexpr uint8_t H = (N + 1) / 2;
+    AH::Array<int, H> half;
+    AH::Array<int, N> full;
+    for (uint8_t i = 0; i < H; ++i)
+        half[i] = int(i * 7 % 11) - 5;
+    if (Antisymmetric && N % 2 == 1)
+        half[H - 1] = 0;
+    for (uint8_t i = 0; i < N; ++i)
+        full[i] = i < H ? half[i] : (Antisymmetric ? -1 : 1) * half[N - 1 - i];
+
+    FIRFilter<N, int> reference = full;
+    SymmetricFIRFilter<N, int, Antisymmetric> filter = half;
+    int seed = 7;
+    for (unsigned n = 0; n < 3 * N + 10; ++n) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        int x = (seed >> 16) % 2001 - 1000;
+        EXPECT_EQ(filter(x), reference(x)) << n;
+    }
+}
+
+TEST(SymmetricFIRFilter, typeI) {
+    testSymmetricFIRFilter<1, false>();
+    testSymmetricFIRFilter<3, false>();
+    testSymmetricFIRFilter<11, false>();
+    testSymmetricFIRFilter<31, false>();
+}
+
+TEST(SymmetricFIRFilter, typeII) {
+    testSymmetricFIRFilter<2, false>();
+    testSymmetricFIRFilter<4, false>();
+    testSymmetricFIRFilter<12, false>();
+    testSymmetricFIRFilter<64, false>();
+}
+
+TEST(SymmetricFIRFilter, typeIII) {
+    testSymmetricFIRFilter<3, true>();
+    testSymmetricFIRFilter<11, true>();
+    testSymmetricFIRFilter<31, true>();
+}
+
+TEST(SymmetricFIRFilter, typeIV) {
+    testSymmetricFIRFilter<2, true>();
+    testSymmetricFIRFilter<12, true>();
+    testSymmetricFIRFilter<64, true>();
+}
+
+TEST(SymmetricFIRFilter, size) {
+    EXPECT_LT(sizeof(SymmetricFIRFilter<31, float>),
+              sizeof(FIRFilter<31, float>));
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <Filters/Butterworth.hpp>
+#include <Filters/TunableSOSFilter.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+TEST(TripleBuffer, singleThread) {
+    TripleBuffer<int> buffer{1};
+    EXPECT_EQ(buffer.readBuffer(), 1);
+    EXPECT_FALSE(buffer.update());
+    buffer.write(2);
+    EXPECT_EQ(buffer.readBuffer(), 1);
+    // Only the latest value is picked up.
+    buffer.write(3);
+    EXPECT_TRUE(buffer.update());
+    EXPECT_EQ(buffer.readBuffer(), 3);
+    EXPECT_FALSE(buffer.update());
+    EXPECT_EQ(buffer.readBuffer(), 3);
+    for (int i = 4; i < 10; ++i) {
+        buffer.writeBuffer() = i;
+        buffer.publish();
+        EXPECT_TRUE(buffer.update());
+        EXPECT_EQ(buffer.readBuffer(), i);
+    }
+}
+
+TEST(TripleBuffer, multiThreadStress) {
+    constexpr uint32_t updates = 100000;
+    using Value = std::array<uint32_t, 64>;
+    TripleBuffer<Value> buffer{Value{}};
+
+    std::thread writer([&] {
+        for (uint32_t v = 1; v <= updates; ++v) {
+            Value &value = buffer.writeBuffer();
+            for (auto &element : value)
+                element = v;
+            buffer.publish();
+        }
+    });
+
+    uint32_t previous = 0, torn = 0, backwards = 0, received = 0;
+    while (previous != updates) {
+        if (!buffer.update())
+            continue;
+        const Value &value = buffer.readBuffer();
+        for (auto element : value)
+            torn += element != value[0];
+        backwards += value[0] <= previous;
+        previous = value[0];
+        ++received;
+    }
+    writer.join();
+    EXPECT_EQ(torn, 0u);
+    EXPECT_EQ(backwards, 0u);
+    EXPECT_GT(received, 0u);
+}
+
+TEST(TunableSOSFilter, keepsState) {
+    auto low = butter_coeff<4, double>(0.1);
+    auto high = butter_coeff<4, double>(0.3);
+    TunableSOSFilter<double, 2> tunable{low};
+    SOSFilter<double, 2> reference = low;
+    for (int i = 0; i < 100; ++i) {
+        double x = i * 37 % 101 - 50;
+        if (i == 50) {
+            tunable.setCoefficients(high);
+            reference.setCoefficients(high);
+        }
+        EXPECT_EQ(tunable(x), reference(x)) << i;
+    }
+    // Coefficients are applied at the start of a block.
+    double block[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, expected[10];
+    tunable.setCoefficients(low);
+    reference.setCoefficients(low);
+    std::transform(std::begin(block), std::end(block), expected, reference);
+    tunable.process(block, block, 10);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(block[i], expected[i]) << i;
+    EXPECT_FALSE(tunable.applyCoefficients());
+}
+
+// Each set of coefficients consists of three pure gains, 2^(k·10^i) for
+// section i, where k is the "version" of the coefficients. For an input of
+// one, the output of the filter is 2^E, and the decimal digits of E are the
+// versions of the three sections, which must all be the same.
+static SOSCoefficients<double, 3> gainCoefficients(int k) {
+    SOSCoefficients<double, 3> sos;
+    for (int i = 0, scale = 1; i < 3; ++i, scale *= 10)
+        sos[i] = {{{std::ldexp(1., k * scale), 0, 0}}, {{1, 0, 0}}};
+    return sos;
+}
+
+TEST(TunableSOSFilter, multiThreadStress) {
+    constexpr int updates = 99999;
+    TunableSOSFilter<double, 3> filter{gainCoefficients(0)};
+    std::atomic<bool> started{false}, done{false};
+
+    std::thread control([&] {
+        // Don't start updating before the reader is running, so the updates
+        // overlap with the reads.
+        while (!started.load(std::memory_order_acquire))
+            std::this_thread::yield();
+        for (int v = 1; v <= updates; ++v)
+            filter.setCoefficients(gainCoefficients(v % 10));
+        done.store(true, std::memory_order_release);
+    });
+
+    uint32_t samples = 0, inconsistent = 0;
+    double block[16];
+    auto check = [&](double y) {
+        const int e = std::ilogb(y);
+        inconsistent += y != std::ldexp(1., e) || e % 10 != e / 10 % 10 ||
+                        e % 10 != e / 100;
+        ++samples;
+    };
+    started.store(true, std::memory_order_release);
+    // Check done only at the end, so there is at least one iteration, even if
+    // the control thread finishes before this thread gets to run again.
+    do {
+        check(filter(1));
+        std::fill(std::begin(block), std::end(block), 1.);
+        filter.process(block, block, 16);
+        for (double y : block)
+            check(y);
+    } while (!done.load(std::memory_order_acquire));
+    control.join();
+    EXPECT_GT(samples, 0u);
+    EXPECT_EQ(inconsistent, 0u) << "out of " << samples << " samples";
+    // The final coefficients differ from the initial ones, and are picked up.
+    static_assert(updates % 10 != 0, "final version must differ from initial");
+    EXPECT_EQ(filter(1), std::ldexp(1., 111 * (updates % 10)));
+}
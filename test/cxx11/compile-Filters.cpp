@@ -0,0 +1,28 @@
+// Compiled with -std=gnu++11, the default of many Arduino cores, to make sure
+// that the filter design headers used by the examples don't rely on C++14.
+
+#include <Filters/Butterworth.hpp>
+#include <Filters/Chebyshev.hpp>
+#include <Filters/Elliptic.hpp>
+#include <Filters/FilterOrder.hpp>
+
+float cxx11_butter(float x) {
+    static auto lowpass = butter<4>(0.1);
+    return lowpass(x);
+}
+
+float cxx11_butter_bands(float x) {
+    static auto highpass = butter_highpass<3>(0.1);
+    static auto bandpass = butter_bandpass<2>(0.1, 0.3);
+    static auto bandstop = butter_bandstop<2>(0.2, 0.25);
+    return bandstop(bandpass(highpass(x)));
+}
+
+float cxx11_cheby_ellip(float x) {
+    static auto cheby_1 = cheby1<4>(0.1, 1);
+    static auto cheby_2 = cheby2<4>(0.1, 40);
+    static auto elliptic = ellip<4>(0.1, 1, 40);
+    return elliptic(cheby_2(cheby_1(x)));
+}
+
+uint8_t cxx11_order() { return ellip_order(0.1, 0.2, 1, 40).N; }